@@ -1,5 +1,6 @@
 #include <unistd.h>
 
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -10,14 +11,33 @@
 #include "elfdisas.h"
 
 std::string strategy = "linearsweep";
+size_t columnWidth = 0;
+size_t numThreads = 1;
+
+// a failed write of the listing, e.g. to a full disk, is a failure of the
+// whole run
+int exitStatus(const ELFDisAssembler& eda) {
+    if (eda.out.error() != 0) {
+        std::cerr << "cannot write the listing: "
+                  << std::strerror(eda.out.error()) << std::endl;
+        return 1;
+    }
+    return 0;
+}
 
 int main(int argc, char* argv[]) {
     int opt;
-    while ((opt = getopt(argc, argv, "s:")) != -1) {
+    while ((opt = getopt(argc, argv, "s:w:j:")) != -1) {
         switch (opt) {
             case 's':
                 strategy = std::string(optarg);
                 break;
+            case 'w':
+                columnWidth = std::stoul(optarg);
+                break;
+            case 'j':
+                numThreads = std::stoul(optarg);
+                break;
             default:
                 std::cout << "unknown parameter is specified" << std::endl;
                 break;
@@ -26,14 +46,17 @@ int main(int argc, char* argv[]) {
 
     std::string binaryPath = argv[optind];
 
-    ELFDisAssembler eda(binaryPath, strategy);
+    ELFDisAssembler eda(binaryPath, strategy, numThreads);
+
+    if (columnWidth > 0) {
+        eda.streamPrint(columnWidth);
+        eda.printErrorReport();
+        return exitStatus(eda);
+    }
 
-    eda.disas(".plt");
-    eda.disas(".plt.got");
-    eda.disas(".plt.sec");
-    eda.disas(".text");
-    eda.disas(".init");
-    eda.disas(".fini");
+    eda.disasAll();
 
     eda.print();
+    eda.printErrorReport();
+    return exitStatus(eda);
 }
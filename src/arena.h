@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @brief Defines a bump-pointer arena for strings.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct StringArena
+ * @brief Copies strings into large chunks with a bump pointer. The copies
+ * stay valid until the arena is cleared or destroyed, which frees all of
+ * them at once.
+ */
+struct StringArena {
+    /**
+     * @brief The size of a chunk in bytes.
+     */
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+    StringArena() = default;
+    StringArena(const StringArena &) = delete;
+    StringArena &operator=(const StringArena &) = delete;
+
+    /**
+     * @brief Copies a string into the arena.
+     * @param str The string.
+     * @return The view of the copy.
+     */
+    std::string_view store(std::string_view str) {
+        if (str.empty()) {
+            return std::string_view();
+        }
+        if (str.size() > static_cast<size_t>(chunkEnd - cur)) {
+            size_t size = std::max(CHUNK_SIZE, str.size());
+            chunks.emplace_back(new char[size]);
+            cur = chunks.back().get();
+            chunkEnd = cur + size;
+        }
+        char *copy = cur;
+        std::memcpy(copy, str.data(), str.size());
+        cur += str.size();
+        used += str.size();
+        return std::string_view(copy, str.size());
+    }
+
+    /**
+     * @brief Frees all strings.
+     */
+    void clear() {
+        chunks.clear();
+        cur = chunkEnd = nullptr;
+        used = 0;
+    }
+
+    /**
+     * @brief Gets the total size of the stored strings.
+     * @return The size in bytes.
+     */
+    size_t bytesUsed() const { return used; }
+
+   private:
+    std::vector<std::unique_ptr<char[]>> chunks; /**< The chunks */
+    char *cur = nullptr;      /**< The next free byte of the last chunk */
+    char *chunkEnd = nullptr; /**< The end of the last chunk */
+    size_t used = 0;          /**< The total size of the stored strings */
+};
@@ -0,0 +1,251 @@
+/**
+ * @file
+ * @brief Defines a bitmap with word-parallel range operations, used to track
+ * which bytes have been decoded.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct CoverageBitmap
+ * @brief One bit per byte of the object code, stored in 64-bit words. Range
+ * operations touch whole words, and searches skip 64 bytes per step.
+ */
+struct CoverageBitmap {
+    /**
+     * @brief Constructor for CoverageBitmap.
+     * @param numBits The number of bits, all initially unset.
+     */
+    explicit CoverageBitmap(size_t numBits = 0)
+        : numBits(numBits), words((numBits + 63) / 64, 0) {}
+
+    /**
+     * @brief Gets the number of bits.
+     * @return The number of bits.
+     */
+    size_t size() const { return numBits; }
+
+    /**
+     * @brief Checks whether a bit is set.
+     * @param idx The index of the bit.
+     * @return True if the bit is set.
+     */
+    bool test(size_t idx) const {
+        return (words[idx >> 6] >> (idx & 63)) & 1;
+    }
+
+    /**
+     * @brief Checks whether a bit is set.
+     * @param idx The index of the bit.
+     * @return True if the bit is set.
+     */
+    bool operator[](size_t idx) const { return test(idx); }
+
+    /**
+     * @brief Sets a bit.
+     * @param idx The index of the bit.
+     */
+    void set(size_t idx) { words[idx >> 6] |= uint64_t(1) << (idx & 63); }
+
+    /**
+     * @brief Unsets a bit.
+     * @param idx The index of the bit.
+     */
+    void reset(size_t idx) {
+        words[idx >> 6] &= ~(uint64_t(1) << (idx & 63));
+    }
+
+    /**
+     * @brief Checks whether any bit in [begin, end) is set.
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     * @return True if a bit in the range is set.
+     */
+    bool any(size_t begin, size_t end) const {
+        bool found = false;
+        forEachWord(words.data(), begin, end,
+                    [&](uint64_t word, uint64_t mask) {
+                        found = found || (word & mask) != 0;
+                    });
+        return found;
+    }
+
+    /**
+     * @brief Sets all bits in [begin, end).
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     */
+    void setRange(size_t begin, size_t end) {
+        forEachWord(words.data(), begin, end,
+                    [](uint64_t& word, uint64_t mask) { word |= mask; });
+    }
+
+    /**
+     * @brief Unsets all bits in [begin, end).
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     */
+    void resetRange(size_t begin, size_t end) {
+        forEachWord(words.data(), begin, end,
+                    [](uint64_t& word, uint64_t mask) { word &= ~mask; });
+    }
+
+    /**
+     * @brief Sets all bits in [begin, end) if none of them is set.
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     * @return True if the bits were set, false if any was already set.
+     */
+    bool testAndSetRange(size_t begin, size_t end) {
+        if (any(begin, end)) {
+            return false;
+        }
+        setRange(begin, end);
+        return true;
+    }
+
+    /**
+     * @brief Finds the first unset bit in [begin, end).
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     * @return The index of the bit, or end if all bits are set.
+     */
+    size_t findNextUnset(size_t begin, size_t end) const {
+        return findNext(begin, end, ~uint64_t(0));
+    }
+
+    /**
+     * @brief Finds the first set bit in [begin, end).
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     * @return The index of the bit, or end if no bit is set.
+     */
+    size_t findNextSet(size_t begin, size_t end) const {
+        return findNext(begin, end, 0);
+    }
+
+    /**
+     * @brief Counts the set bits in [begin, end).
+     * @param begin The first index.
+     * @param end The index just after the last one.
+     * @return The number of set bits.
+     */
+    size_t count(size_t begin, size_t end) const {
+        size_t n = 0;
+        forEachWord(words.data(), begin, end,
+                    [&](uint64_t word, uint64_t mask) {
+                        n += __builtin_popcountll(word & mask);
+                    });
+        return n;
+    }
+
+    /**
+     * @brief Counts all set bits.
+     * @return The number of set bits.
+     */
+    size_t count() const { return count(0, numBits); }
+
+   private:
+    size_t numBits;              /**< The number of bits */
+    std::vector<uint64_t> words; /**< The bits, 64 per word */
+
+    /**
+     * @brief Calls f(word, mask) for each word overlapping [begin, end),
+     * where mask selects the bits of the word inside the range.
+     */
+    template <typename Word, typename F>
+    static void forEachWord(Word* data, size_t begin, size_t end, F f) {
+        if (begin >= end) {
+            return;
+        }
+        size_t first = begin >> 6;
+        size_t last = (end - 1) >> 6;
+        uint64_t headMask = ~uint64_t(0) << (begin & 63);
+        uint64_t tailMask = ~uint64_t(0) >> (63 - ((end - 1) & 63));
+        if (first == last) {
+            f(data[first], headMask & tailMask);
+            return;
+        }
+        f(data[first], headMask);
+        for (size_t w = first + 1; w < last; w++) {
+            f(data[w], ~uint64_t(0));
+        }
+        f(data[last], tailMask);
+    }
+
+    /**
+     * @brief Finds the first bit in [begin, end) that differs from the bits
+     * of flip, i.e. the first set bit of (word ^ flip).
+     */
+    size_t findNext(size_t begin, size_t end, uint64_t flip) const {
+        if (begin >= end) {
+            return end;
+        }
+        size_t w = begin >> 6;
+        uint64_t bits = (words[w] ^ flip) & (~uint64_t(0) << (begin & 63));
+        size_t last = (end - 1) >> 6;
+        while (bits == 0) {
+            if (++w > last) {
+                return end;
+            }
+            bits = words[w] ^ flip;
+        }
+        size_t idx = (w << 6) + __builtin_ctzll(bits);
+        return idx < end ? idx : end;
+    }
+};
+
+/**
+ * @struct AtomicBitmap
+ * @brief A bitmap whose bits can be claimed by several threads at once.
+ */
+struct AtomicBitmap {
+    /**
+     * @brief Constructor for AtomicBitmap.
+     * @param numBits The number of bits, all initially unset.
+     */
+    explicit AtomicBitmap(size_t numBits)
+        : numBits(numBits),
+          words(new std::atomic<uint64_t>[(numBits + 63) / 64]) {
+        for (size_t w = 0; w < (numBits + 63) / 64; w++) {
+            words[w].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Gets the number of bits.
+     * @return The number of bits.
+     */
+    size_t size() const { return numBits; }
+
+    /**
+     * @brief Checks whether a bit is set.
+     * @param idx The index of the bit.
+     * @return True if the bit is set.
+     */
+    bool test(size_t idx) const {
+        return (words[idx >> 6].load(std::memory_order_relaxed) >>
+                (idx & 63)) &
+               1;
+    }
+
+    /**
+     * @brief Sets a bit, atomically.
+     * @param idx The index of the bit.
+     * @return True if this call set the bit, false if it was already set.
+     */
+    bool claim(size_t idx) {
+        uint64_t bit = uint64_t(1) << (idx & 63);
+        return (words[idx >> 6].fetch_or(bit, std::memory_order_relaxed) &
+                bit) == 0;
+    }
+
+   private:
+    size_t numBits;                                 /**< The number of bits */
+    std::unique_ptr<std::atomic<uint64_t>[]> words; /**< The bits */
+};
@@ -1,280 +1,127 @@
 /**
  * @file
- * @brief Defines structures for decoding x86 ModRM and SIB bytes.
+ * @brief Defines the precomputed decode tables of the x86 ModRM and SIB
+ * bytes.
  */
 
 #pragma once
-#include <iostream>
-#include <unordered_map>
-#include <unordered_set>
+#include <cstdint>
 
-#include "constants.h"
-#include "utils.h"
+/**
+ * @brief Gets the extension of the reg field of ModRM (REX.R).
+ * @param rexByte The REX prefix byte, or 0 if there is none.
+ * @return 8 if REX.R is set, 0 otherwise.
+ */
+constexpr int rexR(int rexByte) { return (rexByte & 0x4) << 1; }
 
 /**
- * @struct REX
- * @brief Represents the REX prefix byte in x86 instruction encoding.
+ * @brief Gets the extension of the index field of SIB (REX.X).
+ * @param rexByte The REX prefix byte, or 0 if there is none.
+ * @return 8 if REX.X is set, 0 otherwise.
  */
-struct REX {
-    bool rexB;
-    bool rexX;
-    bool rexR;
-    bool rexW;
+constexpr int rexX(int rexByte) { return (rexByte & 0x2) << 2; }
 
-    /**
-     * @brief Default constructor for REX.
-     */
-    REX() : rexB(false), rexX(false), rexR(false), rexW(false) {}
+/**
+ * @brief Gets the extension of the rm field of ModRM or the base field of
+ * SIB (REX.B).
+ * @param rexByte The REX prefix byte, or 0 if there is none.
+ * @return 8 if REX.B is set, 0 otherwise.
+ */
+constexpr int rexB(int rexByte) { return (rexByte & 0x1) << 3; }
 
-    /**
-     * @brief Constructor for REX with byte parameter.
-     * @param rexByte The REX prefix byte.
-     */
-    REX(unsigned char rexByte) {
-        rexB = (rexByte & 0x1) == 0x1;
-        rexX = (rexByte & 0x2) == 0x2;
-        rexR = (rexByte & 0x4) == 0x4;
-        rexW = (rexByte & 0x8) == 0x8;
-    }
-};
+/**
+ * @brief Checks whether REX.W is set.
+ * @param rexByte The REX prefix byte, or 0 if there is none.
+ * @return True if REX.W is set.
+ */
+constexpr bool rexW(int rexByte) { return (rexByte & 0x8) != 0; }
 
 /**
  * @struct ModRM
- * @brief Represents the ModRM byte in x86 instruction encoding.
+ * @brief Represents the ModRM byte in x86 instruction encoding. The REX
+ * extensions are not applied; OR in rexR/rexB to get register numbers.
  */
 struct ModRM {
-    REX rex;
-    int modByte;
-    int regByte;
-    int rmByte;
-
-    // std::string addressingMode;
-    // std::string reg;
-
-    bool hasDisp8;
-    bool hasDisp32;
-    bool hasSib;
-
-    /**
-     * @brief Default constructor for ModRM.
-     */
-    ModRM()
-        : modByte(0),
-          regByte(0),
-          rmByte(0),
-          hasDisp8(false),
-          hasDisp32(false),
-          hasSib(false) {}
-
-    /**
-     * @brief Constructor for ModRM with byte parameter.
-     * @param modrmByte The ModRM byte.
-     * @param rex The associated REX prefix.
-     */
-    ModRM(unsigned char modrmByte, REX rex) : rex(rex) {
-        rmByte = modrmByte & 0x7;
-        regByte = (modrmByte >> 3) & 0x7;
-        modByte = (modrmByte >> 6) & 0x3;
-        hasSib = false;
-
-        if (modByte < 3 && rmByte == 4) {
-            hasSib = true;
-        }
-        switch (modByte) {
-            case 0: {
-                hasDisp8 = false;
-                hasDisp32 = false;
-                break;
-            }
-            case 1: {
-                hasDisp8 = true;
-                hasDisp32 = false;
-                break;
-            }
-            case 2: {
-                hasDisp8 = false;
-                hasDisp32 = true;
-                break;
-            }
-            case 3: {
-                hasDisp8 = false;
-                hasDisp32 = false;
-                break;
-            }
-        }
-
-        if (modByte == 0 && rmByte == 5) {
-            hasDisp8 = false;
-            hasDisp32 = true;
-        }
-    }
-
-    /**
-     * @brief Gets the register name based on the operand type.
-     * @param operand The operand type.
-     * @return The register name.
-     */
-    std::string getReg(Operand operand) {
-        if (operand == Operand::xmm) {
-            return "xmm" + std::to_string(regByte + (rex.rexR ? 8 : 0));
-        } else {
-            return operand2register(operand)->at(regByte + (rex.rexR ? 8 : 0));
-        }
-    }
-
-    /**
-     * @brief Generates the addressing mode string.
-     * @param operand The operand type.
-     * @param disp8 The 8-bit displacement.
-     * @param disp32 The 32-bit displacement.
-     * @return The addressing mode string.
-     */
-    std::string getAddrMode(Operand operand, std::string disp8,
-                            std::string disp32) {
-        std::string addrBaseReg;
-        if (modByte == 3) {
-            if (operand == Operand::xm128) {
-                addrBaseReg =
-                    "xmm" + std::to_string(rmByte + (rex.rexB ? 8 : 0));
-            } else {
-                addrBaseReg =
-                    operand2register(operand)->at(rmByte + (rex.rexB ? 8 : 0));
-            }
-        } else {
-            if (operand == Operand::xm128) {
-                addrBaseReg =
-                    "xmm" + std::to_string(rmByte + (rex.rexB ? 8 : 0));
-            } else {
-                addrBaseReg = REGISTERS64.at(rmByte + (rex.rexB ? 8 : 0));
-            }
-        }
-
-        if (modByte < 3 && rmByte == 4) {
-            addrBaseReg = "SIB";
-        }
-
-        std::string addressingMode;
-        switch (modByte) {
-            case 0: {
-                addressingMode = "[" + addrBaseReg + "]";
-                break;
-            }
-            case 1: {
-                addressingMode = "[" + addrBaseReg + disp8 + "]";
-                break;
-            }
-            case 2: {
-                addressingMode = "[" + addrBaseReg + disp32 + "]";
-                break;
-            }
-            case 3: {
-                addressingMode = addrBaseReg;
-                break;
-            }
-        }
-
-        if (modByte == 0 && rmByte == 5) {
-            addressingMode = "[rip" + disp32 + "]";
-        }
-
-        return addressingMode;
-    }
+    uint8_t modByte;  /**< The mod field */
+    uint8_t regByte;  /**< The reg field */
+    uint8_t rmByte;   /**< The rm field */
+    uint8_t dispSize; /**< The size of the displacement (0, 1 or 4), not
+                         counting the SIB disp32 of mod 0 and base 5 */
+    bool hasSib;      /**< Whether the SIB byte follows */
+    bool isRipRel;    /**< Whether this is [rip + disp32] */
 };
 
 /**
  * @struct SIB
  * @brief Represents the SIB (Scale-Index-Base) byte in x86 instruction
- * encoding.
+ * encoding. The REX extensions are not applied; OR in rexX/rexB to get
+ * register numbers.
  */
 struct SIB {
-    unsigned char scaleByte;
-    unsigned char indexByte;
-    unsigned char baseByte;
-    unsigned char modByte;
-    REX rex;
-
-    std::string address;
-    std::string addrBaseReg, indexReg;
-    int scale;
-    bool hasDisp8;
-    bool hasDisp32;
-
-    /**
-     * @brief Default constructor for SIB.
-     */
-    SIB() : hasDisp8(false), hasDisp32(false) {}
-
-    /**
-     * @brief Constructor for SIB with byte parameters.
-     * @param sibByte The SIB byte.
-     * @param modByte The associated mod field from ModRM.
-     * @param rex The associated REX prefix.
-     */
-    SIB(unsigned char sibByte, unsigned char modByte, REX rex)
-        : modByte(modByte), rex(rex) {
-        scaleByte = (sibByte >> 6) & 0x3;
-        indexByte = (sibByte >> 3) & 0x7;
-        baseByte = sibByte & 0x7;
-
-        hasDisp8 = baseByte == 5 && modByte == 1;
-        hasDisp32 = baseByte == 5 && modByte != 1;
-    }
-
-    /**
-     * @brief Generates the address string.
-     * @param operand The operand type.
-     * @param disp8 The 8-bit displacement.
-     * @param disp32 The 32-bit displacement.
-     * @return The address string.
-     */
-    std::string getAddr(Operand operand, std::string disp8,
-                        std::string disp32) {
-        std::string offset = "";
+    uint8_t scaleByte; /**< The scale field */
+    uint8_t indexByte; /**< The index field */
+    uint8_t baseByte;  /**< The base field */
+    uint8_t scale;     /**< The scale factor (1, 2, 4 or 8) */
+};
 
-        if (baseByte == 5) {
-            switch (modByte) {
-                case 0: {
-                    if (disp32.size() > 2) {
-                        if (disp32[1] == '+') {
-                            addrBaseReg = disp32.substr(3, disp32.size() - 3);
-                        } else {
-                            addrBaseReg =
-                                "-" + disp32.substr(3, disp32.size() - 3);
-                        }
-                    }
-                    break;
-                }
-                case 1: {
-                    addrBaseReg = rex.rexB ? "r13" : "rbp";
-                    offset = disp8;
-                    break;
-                }
-                case 2: {
-                    addrBaseReg = rex.rexB ? "r13" : "rbp";
-                    offset = disp32;
-                    break;
-                }
-            }
-        } else {
-            addrBaseReg = REGISTERS64.at(baseByte + (rex.rexB ? 8 : 0));
-            if (modByte == 1) {
-                offset = disp8;
-            } else if (modByte == 2) {
-                offset = disp32;
+/**
+ * @struct ModRMTable
+ * @brief The decoded fields of all 256 ModRM bytes.
+ */
+struct ModRMTable {
+    ModRM entries[256];
+
+    constexpr ModRMTable() : entries{} {
+        for (int byte = 0; byte < 256; byte++) {
+            ModRM& e = entries[byte];
+            e.modByte = (byte >> 6) & 0x3;
+            e.regByte = (byte >> 3) & 0x7;
+            e.rmByte = byte & 0x7;
+            e.hasSib = e.modByte < 3 && e.rmByte == 4;
+            e.isRipRel = e.modByte == 0 && e.rmByte == 5;
+            if (e.modByte == 1) {
+                e.dispSize = 1;
+            } else if (e.modByte == 2 || e.isRipRel) {
+                e.dispSize = 4;
             }
         }
+    }
+
+    constexpr const ModRM& operator[](int byte) const { return entries[byte]; }
+};
 
-        if (modByte == 0 && baseByte == 5 && indexByte == 4) {
-            address = addrBaseReg;
-        } else if (indexByte == 4 && (!rex.rexX)) {
-            address = "[" + addrBaseReg + offset + "]";
-        } else {
-            indexReg = REGISTERS64.at(indexByte + (rex.rexX ? 8 : 0));
-            scale = SCALE_FACTOR.at(scaleByte);
-            address = "[" + addrBaseReg + " + " + indexReg + " * " +
-                      std::to_string(scale) + offset + "]";
+/**
+ * @struct SIBTable
+ * @brief The decoded fields of all 256 SIB bytes.
+ */
+struct SIBTable {
+    SIB entries[256];
+
+    constexpr SIBTable() : entries{} {
+        for (int byte = 0; byte < 256; byte++) {
+            SIB& e = entries[byte];
+            e.scaleByte = (byte >> 6) & 0x3;
+            e.indexByte = (byte >> 3) & 0x7;
+            e.baseByte = byte & 0x7;
+            e.scale = 1 << e.scaleByte;
         }
-        return address;
     }
+
+    constexpr const SIB& operator[](int byte) const { return entries[byte]; }
 };
 
+inline constexpr ModRMTable MODRM_TABLE{};
+inline constexpr SIBTable SIB_TABLE{};
+
+/**
+ * @brief Gets the size of the displacement of a memory operand.
+ * @param modrm The ModRM byte.
+ * @param sib The SIB byte (ignored if the ModRM byte has no SIB).
+ * @return The size of the displacement (0, 1 or 4).
+ */
+constexpr int dispSizeOf(const ModRM& modrm, const SIB& sib) {
+    if (modrm.hasSib && modrm.modByte == 0 && sib.baseByte == 5) {
+        return 4;
+    }
+    return modrm.dispSize;
+}
@@ -1,7 +1,7 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 enum class Operand {
@@ -41,29 +41,29 @@ enum class Operand {
     sti,
 };
 
-inline bool isA_REG(Operand operand) {
+constexpr bool isA_REG(Operand operand) {
     return operand == Operand::al || operand == Operand::ax ||
            operand == Operand::eax || operand == Operand::rax;
 }
 
-inline bool isRM(Operand operand) {
+constexpr bool isRM(Operand operand) {
     return operand == Operand::rm8 || operand == Operand::rm16 ||
            operand == Operand::rm32 || operand == Operand::rm64 ||
            operand == Operand::xm128;
 }
 
-inline bool isM(Operand operand) {
+constexpr bool isM(Operand operand) {
     return operand == Operand::m || operand == Operand::m32fp ||
            operand == Operand::m64fp;
 }
 
-inline bool isREG(Operand operand) {
+constexpr bool isREG(Operand operand) {
     return operand == Operand::reg8 || operand == Operand::reg16 ||
            operand == Operand::reg32 || operand == Operand::reg64 ||
            operand == Operand::xmm || operand == Operand::ymm;
 }
 
-inline bool isIMM(Operand operand) {
+constexpr bool isIMM(Operand operand) {
     return operand == Operand::imm8 || operand == Operand::imm16 ||
            operand == Operand::imm32 || operand == Operand::imm64;
 }
@@ -107,7 +107,7 @@ enum class OpEnc {
     C,
 };
 
-enum class Prefix {
+enum class Prefix : uint8_t {
     NONE,  // without prefix
     P66,   // change the default operand size
     REXW,  // use R8-R15 registers
@@ -129,7 +129,7 @@ inline std::string to_string(Prefix prefix) {
     }
 }
 
-enum class Mnemonic {
+enum class Mnemonic : uint8_t {
     SETNE,
     FXCH,
     FADD,
@@ -240,6 +240,7 @@ enum class Mnemonic {
     STC,
     CLC,
     BSWAP,
+    INVALID,  // not a valid instruction
 };
 
 inline std::string to_string(Mnemonic mnemonic) {
@@ -570,7 +571,7 @@ inline std::string to_string(Operand opu) {
     }
 }
 
-inline bool hasModrm(OpEnc openc) {
+constexpr bool hasModrm(OpEnc openc) {
     switch (openc) {
         case OpEnc::I:
             return false;
@@ -656,17 +657,4 @@ inline std::string to_string(OpEnc openc) {
     }
 }
 
-const std::unordered_set<int> TWO_BYTES_OPCODE_PREFIX = {0x0F, 0xD8, 0xD9,
-                                                         0xDC};
-
-// Predefined prefixes and their associated instructions
-const std::unordered_set<int> INSTRUCTION_PREFIX_SET = {
-    0xF0,
-    0xF2,
-    0xF3,
-    0x3E,
-};
-
-const std::vector<int> SCALE_FACTOR = {1, 2, 4, 8};
-
 const size_t PLT_SEC_ENTRY_SIZE = 16;
@@ -7,60 +7,80 @@
 #include <sched.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <stack>
-#include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "bitmap.h"
+#include "formatter.h"
+#include "span.h"
 #include "state.h"
+#include "store.h"
+#include "symbols.h"
+#include "utils.h"
+#include "worklist.h"
 
 /**
  * @brief The string representation for unknown instructions.
  */
 const std::string UNKNOWN_INSTRUCTION = "UNKNOWN-INSTRUCTION";
 
+/**
+ * @brief The number of instructions decoded at once by the linear sweep.
+ */
+constexpr size_t DECODE_BLOCK_SIZE = 64;
+
+/**
+ * @brief The default size of the chunks of the parallel linear sweep.
+ */
+constexpr size_t PARALLEL_SWEEP_CHUNK_SIZE = 1 << 16;
+
 /**
  * @struct DisAssembler
  * @brief Represents a disassembler for x86 instructions.
  */
 struct DisAssembler {
-    std::vector<bool> isSuccessfullyDisAssembled; /**< Array indicating which
-                                                     bytes have been decoded */
-    const std::vector<unsigned char>
-        &binaryBytes; /**< Byte array of the object source */
-    const std::unordered_map<uint64_t, std::string>
-        &addr2symbol; /**< Mapping of addresses to symbols */
-
-    uint64_t curAddr; /**< The current index to be decoded */
-
-    std::unordered_set<std::pair<uint64_t, uint64_t>>
-        disassembledPositions; /**< Set of disassembled positions */
-    std::unordered_map<std::pair<uint64_t, uint64_t>, std::string>
-        disassembledInstructions; /**< Mapping of index to disassembled
-                                     instructions */
-    std::unordered_map<uint64_t, uint64_t>
-        disassembledInstructionsSize; /**< Mapping of address to instruction
-                                           length */
+    ByteSpan binaryBytes; /**< Byte array of the object source */
+    const SymbolIndex &addr2symbol; /**< The symbols, sorted by address */
+
+    uint64_t curAddr;     /**< The current index to be decoded */
+    uint64_t decodeBegin; /**< The start of the range being disassembled */
+    uint64_t decodeEnd;   /**< The end of the range being disassembled;
+                             instructions are clamped to it */
+    CoverageBitmap
+        isSuccessfullyDisAssembled; /**< Bitmap indicating which bytes of
+                                       [decodeBegin, decodeEnd) have been
+                                       decoded, indexed from decodeBegin */
+
+    InstructionStore instructions; /**< Disassembled instructions ordered
+                                      by address */
     std::vector<uint64_t> errorAddrs; /**< Keeps track of error bytes indexes */
+    DecodeErrorReport errorReport;    /**< Aggregated decode failures */
     size_t maxInstructionStrSize =
         0; /**< The maximum length of the instruction string */
+    size_t numThreads = 1; /**< The number of threads used to disassemble */
+    std::vector<uint64_t> roots; /**< Additional starting addresses of the
+                                    recursive descent (e.g. symbols) */
 
     /**
      * @brief Constructor for DisAssembler.
      * @param binaryBytes The byte array of the object source.
-     * @param addr2symbol Mapping of addresses to symbols.
+     * @param addr2symbol The symbols, sorted by address.
      */
-    DisAssembler(const std::vector<unsigned char> &binaryBytes,
-                 const std::unordered_map<uint64_t, std::string> &addr2symbol)
-        : binaryBytes(binaryBytes), addr2symbol(addr2symbol), curAddr(0) {
-        isSuccessfullyDisAssembled =
-            std::vector<bool>(binaryBytes.size(), false);
-    }
+    DisAssembler(ByteSpan binaryBytes, const SymbolIndex &addr2symbol)
+        : binaryBytes(binaryBytes),
+          addr2symbol(addr2symbol),
+          curAddr(0),
+          decodeBegin(0),
+          decodeEnd(binaryBytes.size()) {}
 
     /**
      * @brief Disassembles instructions within the specified range.
@@ -71,79 +91,210 @@ struct DisAssembler {
 
     /**
      * @brief Stores the disassembled instruction.
-     * @param instruction The disassembled instruction.
+     * @param instruction The decoded instruction.
      */
-    void storeInstruction(DisassembledResult instruction) {
-        uint64_t nextAddr =
-            instruction.startAddr + instruction.disassembledInstructionSize;
-
-        // skip if this has already been decoded
-        for (uint64_t idx = instruction.startAddr; idx < nextAddr; ++idx) {
-            if (isSuccessfullyDisAssembled[idx]) {
-                return;
-            }
-        }
+    void storeInstruction(const DecodedInstruction &instruction) {
+        storeInstruction(instruction, std::string_view());
+    }
 
-        // mark the decoded regions
-        for (uint64_t idx = instruction.startAddr; idx < nextAddr; ++idx) {
-            isSuccessfullyDisAssembled[idx] = true;
+    /**
+     * @brief Stores the disassembled instruction with its text formatted in
+     * advance.
+     * @param instruction The decoded instruction.
+     * @param text The text of the instruction, or an empty string to format
+     * it here.
+     */
+    void storeInstruction(const DecodedInstruction &instruction,
+                          std::string_view text) {
+        uint64_t nextAddr = instruction.nextAddr();
+
+        // skip if this has already been decoded, otherwise mark the region
+        if (!coverage().testAndSetRange(instruction.startAddr - decodeBegin,
+                                        nextAddr - decodeBegin)) {
+            return;
         }
 
-        // mark the regions causing errors
-        if (!errorAddrs.empty()) {
-            uint64_t startErr = errorAddrs[0];
-            uint64_t disassembledInstructionSizegthErr = errorAddrs.size();
-            disassembledInstructions[std::make_pair(
-                startErr, startErr + disassembledInstructionSizegthErr)] =
-                UNKNOWN_INSTRUCTION;
-            disassembledPositions.emplace(std::make_pair(
-                startErr, startErr + disassembledInstructionSizegthErr));
-            errorAddrs.clear();
+        // the text is formatted into a reused buffer and copied into the
+        // arena of the store, so that no string is allocated per instruction
+        if (text.empty()) {
+            formatBuffer.clear();
+            appendInstruction(formatBuffer, instruction, addr2symbol,
+                              decodeBegin, decodeEnd);
+            text = formatBuffer;
         }
+        maxInstructionStrSize = std::max(maxInstructionStrSize, text.size());
+        instructions.add(instruction.startAddr, nextAddr, text);
+    }
 
-        disassembledInstructions[std::make_pair(instruction.startAddr,
-                                                nextAddr)] =
-            instruction.disassembledInstructionStr;
-        maxInstructionStrSize =
-            std::max(maxInstructionStrSize,
-                     instruction.disassembledInstructionStr.size());
-        disassembledPositions.emplace(
-            std::make_pair(instruction.startAddr, nextAddr));
-        disassembledInstructionsSize[instruction.startAddr] =
-            instruction.disassembledInstructionSize;
-
-        return;
+    /**
+     * @brief Stores the pending error bytes as unknown instructions, one for
+     * each contiguous run of them. Bytes covered by a decoded instruction
+     * are dropped, so that no record overlaps the instructions; hence this
+     * is called once the range has been disassembled.
+     */
+    void flushErrors() {
+        std::sort(errorAddrs.begin(), errorAddrs.end());
+        errorAddrs.erase(std::unique(errorAddrs.begin(), errorAddrs.end()),
+                         errorAddrs.end());
+        size_t i = 0;
+        while (i < errorAddrs.size()) {
+            uint64_t startErr = errorAddrs[i++];
+            if (isDecoded(startErr)) {
+                continue;
+            }
+            uint64_t endErr = startErr + 1;
+            while (i < errorAddrs.size() && errorAddrs[i] == endErr &&
+                   !isDecoded(endErr)) {
+                endErr++;
+                i++;
+            }
+            instructions.add(startErr, endErr, UNKNOWN_INSTRUCTION);
+        }
+        errorAddrs.clear();
     }
 
     /**
-     * @brief Stores an error in decoding.
+     * @brief Stores an error in decoding. The bytes keep their coverage,
+     * since an error inside a decoded instruction does not undo it.
      * @param startAddr The starting address of the error.
      * @param disassembledInstructionSizegth The length of the error.
      */
-    void storeError(int startAddr, int disassembledInstructionSizegth) {
-        for (int i = startAddr; i < startAddr + disassembledInstructionSizegth;
-             i++) {
-            isSuccessfullyDisAssembled[i] = false;
+    void storeError(uint64_t startAddr,
+                    uint64_t disassembledInstructionSizegth) {
+        for (uint64_t i = startAddr;
+             i < startAddr + disassembledInstructionSizegth; i++) {
             errorAddrs.emplace_back(i);
         }
     }
 
+    /**
+     * @brief Stores the decoded instruction, or records the failure in
+     * errorReport if it could not be decoded.
+     * @param instruction The decoded instruction.
+     * @param text The text of the instruction, or an empty string to format
+     * it here.
+     */
+    void storeDecoded(const DecodedInstruction &instruction,
+                      std::string_view text = std::string_view()) {
+        if (instruction.status == DecodeStatus::OK) {
+            storeInstruction(instruction, text);
+        } else {
+            errorReport.add(instruction.status, instruction.prefix,
+                            instruction.opcode, instruction.startAddr);
+        }
+    }
+
+    /**
+     * @brief Counts the bytes covered by decoded instructions.
+     * @param startAddr The starting address.
+     * @param endAddr The address just after the last byte.
+     * @return The number of decoded bytes in [startAddr, endAddr).
+     */
+    size_t coveredBytes(uint64_t startAddr, uint64_t endAddr) const {
+        uint64_t windowEnd = decodeBegin + isSuccessfullyDisAssembled.size();
+        startAddr = std::max(startAddr, decodeBegin);
+        endAddr = std::min(endAddr, windowEnd);
+        if (startAddr >= endAddr) {
+            return 0;
+        }
+        return isSuccessfullyDisAssembled.count(startAddr - decodeBegin,
+                                                endAddr - decodeBegin);
+    }
+
+    /**
+     * @brief Finds the first byte not covered by a decoded instruction.
+     * @param startAddr The starting address.
+     * @param endAddr The address just after the last byte.
+     * @return The address of the byte, or endAddr if there is none.
+     */
+    uint64_t nextGap(uint64_t startAddr, uint64_t endAddr) const {
+        uint64_t windowEnd = decodeBegin + isSuccessfullyDisAssembled.size();
+        if (startAddr < decodeBegin || startAddr >= windowEnd) {
+            return startAddr;
+        }
+        return decodeBegin + isSuccessfullyDisAssembled.findNextUnset(
+                                 startAddr - decodeBegin,
+                                 std::min(endAddr, windowEnd) - decodeBegin);
+    }
+
+    /**
+     * @brief Checks whether a byte is covered by a decoded instruction.
+     * @param addr The address of the byte.
+     * @return True if the byte has been decoded in the current range.
+     */
+    bool isDecoded(uint64_t addr) const {
+        return addr >= decodeBegin &&
+               addr - decodeBegin < isSuccessfullyDisAssembled.size() &&
+               isSuccessfullyDisAssembled[addr - decodeBegin];
+    }
+
+    /**
+     * @brief Gets the coverage bitmap of the range being disassembled. The
+     * bitmap is sized to the range and allocated on first use.
+     * @return The bitmap.
+     */
+    CoverageBitmap &coverage() {
+        if (isSuccessfullyDisAssembled.size() != decodeEnd - decodeBegin) {
+            isSuccessfullyDisAssembled =
+                CoverageBitmap(decodeEnd - decodeBegin);
+        }
+        return isSuccessfullyDisAssembled;
+    }
+
+    /**
+     * @brief Sets the range being disassembled. The state of the previous
+     * range is dropped, so that it is only as large as the section.
+     * @param startAddr The first address of the range.
+     * @param endAddr The last address of the range.
+     */
+    void setDecodeRange(uint64_t startAddr, uint64_t endAddr) {
+        decodeEnd =
+            endAddr < binaryBytes.size() ? endAddr + 1 : binaryBytes.size();
+        decodeBegin = std::min(startAddr, decodeEnd);
+        isSuccessfullyDisAssembled = CoverageBitmap();
+    }
+
+    /**
+     * @brief Checks whether the loader padded the bytes after decodeEnd.
+     * @return True if DECODE_PADDING bytes after decodeEnd are readable.
+     */
+    bool isPadded() const {
+        return decodeEnd + DECODE_PADDING <= binaryBytes.size();
+    }
+
     /**
      * @brief Executes a step in disassembling the instruction.
-     * @return The disassembled result.
+     * @return The decoded instruction.
      */
-    DisassembledResult step() {
-        State state(binaryBytes, addr2symbol);
-        DisassembledResult instruction = state.step(getCurAddr());
-        storeInstruction(instruction);
+    DecodedInstruction step() {
+        State state(binaryBytes.data(), binaryBytes.data() + decodeEnd,
+                    isPadded());
+        DecodedInstruction instruction = state.step(getCurAddr());
+        storeDecoded(instruction);
         return instruction;
     }
 
+    /**
+     * @brief Converts a decoded instruction into text. Targets within the
+     * range being disassembled are labelled relative to the nearest
+     * preceding symbol in the range.
+     * @param instruction The decoded instruction.
+     * @return The instruction text.
+     */
+    std::string format(const DecodedInstruction &instruction) const {
+        return formatInstruction(instruction, addr2symbol, decodeBegin,
+                                 decodeEnd);
+    }
+
     /**
      * @brief Gets the current address being decoded.
      * @return The current address.
      */
-    int getCurAddr() { return curAddr; }
+    uint64_t getCurAddr() { return curAddr; }
+
+   private:
+    std::string formatBuffer; /**< The text of the instruction being stored,
+                                 reused to avoid an allocation for each */
 };
 
 /**
@@ -160,20 +311,137 @@ struct LinearSweepDisAssembler : public DisAssembler {
      */
     void disas(uint64_t startAddr, uint64_t endAddr = -1) {
         curAddr = startAddr;
-        endAddr = (endAddr < 0) ? binaryBytes.size() - 1 : endAddr;
-
-        while (curAddr <= endAddr) {
-            try {
-                DisassembledResult instruction = step();
-                curAddr = instruction.startAddr +
-                          instruction.disassembledInstructionSize;
-            } catch (const std::exception &e) {
-                std::stringstream ss;
-                ss << std::hex << curAddr;
-                std::cerr << ss.str() << ": " << e.what() << std::endl;
-                curAddr += 1;
+        setDecodeRange(startAddr, endAddr);
+
+        if (numThreads > 1 && decodeEnd - decodeBegin > 2 * chunkSize) {
+            parallelDisas();
+            return;
+        }
+
+        DecodedInstruction block[DECODE_BLOCK_SIZE];
+        const uint8_t *end = binaryBytes.data() + decodeEnd;
+        while (curAddr < decodeEnd) {
+            size_t n = decodeBlock(binaryBytes.data() + curAddr, end, curAddr,
+                                   block, DECODE_BLOCK_SIZE, isPadded());
+            for (size_t i = 0; i < n; i++) {
+                storeDecoded(block[i]);
+                curAddr = block[i].nextAddr();
+            }
+        }
+    }
+
+    size_t chunkSize =
+        PARALLEL_SWEEP_CHUNK_SIZE; /**< The size of the chunks of the
+                                      parallel sweep */
+
+   private:
+    /**
+     * @struct SweepChunk
+     * @brief The instructions decoded from the start of a chunk.
+     */
+    struct SweepChunk {
+        uint64_t begin; /**< The first address of the chunk */
+        uint64_t end;   /**< The address just after the chunk */
+        std::vector<DecodedInstruction>
+            decoded;                    /**< The instructions in order */
+        std::vector<std::string> texts; /**< The text of each instruction */
+    };
+
+    /**
+     * @brief Sweeps from addr and appends the instructions starting before
+     * stopAddr to the chunk.
+     * @param chunk The chunk.
+     * @param addr The starting address.
+     * @param stopAddr The address to stop at.
+     * @param maxCount The maximum number of instructions to decode.
+     * @return The address after the last decoded instruction.
+     */
+    uint64_t sweep(SweepChunk &chunk, uint64_t addr, uint64_t stopAddr,
+                   size_t maxCount = -1) {
+        DecodedInstruction block[DECODE_BLOCK_SIZE];
+        const uint8_t *end = binaryBytes.data() + decodeEnd;
+        while (addr < stopAddr && maxCount > 0) {
+            size_t n = decodeBlock(binaryBytes.data() + addr, end, addr, block,
+                                   std::min(DECODE_BLOCK_SIZE, maxCount),
+                                   isPadded());
+            for (size_t i = 0; i < n && addr < stopAddr; i++) {
+                chunk.decoded.push_back(block[i]);
+                chunk.texts.push_back(
+                    block[i].status == DecodeStatus::OK
+                        ? format(block[i])
+                        : std::string());
+                addr = block[i].nextAddr();
+                maxCount--;
+            }
+        }
+        return addr;
+    }
+
+    /**
+     * @brief Sweeps the chunks of the section on numThreads threads, each
+     * from the speculative start at the beginning of its chunk. The chunks
+     * are then stitched in order: where the true instruction stream enters
+     * a chunk at an address that is not a speculative instruction boundary,
+     * only the instructions up to the first common boundary are decoded
+     * again. The result is the same as the sequential sweep.
+     */
+    void parallelDisas() {
+        std::vector<SweepChunk> chunks;
+        for (uint64_t begin = decodeBegin; begin < decodeEnd;
+             begin += chunkSize) {
+            chunks.push_back({begin, std::min<uint64_t>(begin + chunkSize,
+                                                        decodeEnd),
+                              {}, {}});
+        }
+
+        std::atomic<size_t> nextChunk(0);
+        auto worker = [&]() {
+            for (size_t i = nextChunk++; i < chunks.size(); i = nextChunk++) {
+                sweep(chunks[i], chunks[i].begin, chunks[i].end);
+            }
+        };
+        std::vector<std::thread> threads;
+        for (size_t t = 1; t < std::min(numThreads, chunks.size()); t++) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        uint64_t trueAddr = decodeBegin;
+        for (SweepChunk &chunk : chunks) {
+            std::vector<DecodedInstruction> &decoded = chunk.decoded;
+            auto byStart = [](const DecodedInstruction &instruction,
+                              uint64_t addr) {
+                return instruction.startAddr < addr;
+            };
+
+            // decode again from the true boundary until it meets one of the
+            // speculative boundaries
+            SweepChunk prefix;
+            auto sync = decoded.end();
+            while (trueAddr < chunk.end) {
+                sync = std::lower_bound(decoded.begin(), decoded.end(),
+                                        trueAddr, byStart);
+                if (sync != decoded.end() && sync->startAddr == trueAddr) {
+                    break;
+                }
+                trueAddr = sweep(prefix, trueAddr, chunk.end, 1);
+                sync = decoded.end();
+            }
+
+            for (size_t i = 0; i < prefix.decoded.size(); i++) {
+                storeDecoded(prefix.decoded[i], prefix.texts[i]);
+            }
+            for (size_t i = sync - decoded.begin(); i < decoded.size(); i++) {
+                storeDecoded(decoded[i], chunk.texts[i]);
+                trueAddr = decoded[i].nextAddr();
             }
+            std::vector<DecodedInstruction>().swap(decoded);
+            std::vector<std::string>().swap(chunk.texts);
         }
+        curAddr = trueAddr;
     }
 };
 
@@ -184,14 +452,17 @@ struct LinearSweepDisAssembler : public DisAssembler {
 struct RecursiveDescentDisAssembler : public DisAssembler {
     using DisAssembler::DisAssembler;
 
+    CoverageBitmap visited; /**< The addresses the recursive descent has
+                               tried to decode, indexed from decodeBegin */
+
     /**
      * @brief Pops an address from the stack until a valid address is found.
      * @param stackedAddrs The stack of addresses.
-     * @param visited The visited bytes.
+     * @param visited The visited bytes, indexed from decodeBegin.
      * @param isDone Flag indicating if the disassembly is done.
      */
-    void popAddr(std::stack<uint64_t> &stackedAddrs, std::vector<bool> &visited,
-                 bool &isDone) {
+    void popAddr(std::stack<uint64_t> &stackedAddrs,
+                 const CoverageBitmap &visited, bool &isDone) {
         while (true) {
             if (stackedAddrs.empty()) {
                 isDone = true;
@@ -199,7 +470,7 @@ struct RecursiveDescentDisAssembler : public DisAssembler {
             } else {
                 curAddr = stackedAddrs.top();
                 stackedAddrs.pop();
-                if (!isSuccessfullyDisAssembled[curAddr] && !visited[curAddr]) {
+                if (!isDecoded(curAddr) && !visited[curAddr - decodeBegin]) {
                     break;
                 }
             }
@@ -212,71 +483,290 @@ struct RecursiveDescentDisAssembler : public DisAssembler {
      * @param endAddr The ending address.
      */
     void disas(uint64_t startAddr, uint64_t endAddr = -1) {
+        descend(startAddr, endAddr);
+        flushErrors();
+    }
+
+   protected:
+    /**
+     * @brief Follows the control flow of the range, leaving the error bytes
+     * pending.
+     * @param startAddr The starting address.
+     * @param endAddr The ending address.
+     */
+    void descend(uint64_t startAddr, uint64_t endAddr) {
+        curAddr = startAddr;
+        setDecodeRange(startAddr, endAddr);
+        if (decodeBegin >= decodeEnd) {
+            return;
+        }
+        visited = CoverageBitmap(decodeEnd - decodeBegin);
+        if (numThreads > 1) {
+            parallelDisas(startAddr);
+            return;
+        }
+        traverse(startAddr, [this]() { return step(); });
+    }
+
+   private:
+    /**
+     * @brief Follows the control flow from startAddr and the roots,
+     * storing the instructions found on the way.
+     * @param startAddr The starting address.
+     * @param decodeStep The function that decodes and stores the
+     * instruction at curAddr.
+     */
+    template <typename F>
+    void traverse(uint64_t startAddr, F decodeStep) {
         bool isDone = false;
         std::stack<uint64_t> stackedAddrs;
-        std::vector<bool> visited(binaryBytes.size(), false);
-
+        uint64_t endAddr = decodeEnd - 1;
         curAddr = startAddr;
-        endAddr = (endAddr < 0) ? binaryBytes.size() - 1 : endAddr;
+
+        // the roots are explored after startAddr, in the given order
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it) {
+            if (*it >= decodeBegin && *it < decodeEnd) {
+                stackedAddrs.push(*it);
+            }
+        }
 
         while (!isDone) {
-            try {
-                DisassembledResult instruction = step();
-                visited[curAddr] = true;
-                Mnemonic mnemonic = instruction.mnemonic;
-
-                uint64_t nextAddr = instruction.startAddr +
-                                    instruction.disassembledInstructionSize;
-                uint64_t cfAddr =
-                    (uint64_t)((long long)instruction.startAddr +
-                               (long long)
-                                   instruction.disassembledInstructionSize +
-                               instruction.nextOffset);
-
-                if (mnemonic == Mnemonic::RET || nextAddr > endAddr) {
-                    // return to the callee
+            DecodedInstruction instruction = decodeStep();
+            if (instruction.status != DecodeStatus::OK) {
+                visited.set(curAddr - decodeBegin);
+                storeError(curAddr, 1);
+
+                if (curAddr + 1 <= endAddr &&
+                    !visited[curAddr + 1 - decodeBegin]) {
+                    curAddr += 1;
+                } else {
                     popAddr(stackedAddrs, visited, isDone);
-                } else if (isControlFlowInstruction(mnemonic)) {
-                    if (nextAddr == cfAddr) {
-                        if (nextAddr <= endAddr && !visited[nextAddr]) {
-                            curAddr = nextAddr;
-                        } else {
-                            popAddr(stackedAddrs, visited, isDone);
-                        }
+                }
+                continue;
+            }
+
+            visited.set(curAddr - decodeBegin);
+            Mnemonic mnemonic = instruction.mnemonic;
+
+            uint64_t nextAddr = instruction.nextAddr();
+            uint64_t cfAddr = instruction.branchTarget();
+
+            if (mnemonic == Mnemonic::RET || nextAddr > endAddr) {
+                // return to the callee
+                popAddr(stackedAddrs, visited, isDone);
+            } else if (isControlFlowInstruction(mnemonic)) {
+                if (nextAddr == cfAddr) {
+                    if (nextAddr <= endAddr &&
+                        !visited[nextAddr - decodeBegin]) {
+                        curAddr = nextAddr;
                     } else {
-                        if (nextAddr <= endAddr &&
-                            !isSuccessfullyDisAssembled[nextAddr] &&
-                            !visited[nextAddr]) {
-                            stackedAddrs.push(nextAddr);
-                        }
-                        if (cfAddr <= endAddr && !visited[cfAddr]) {
-                            curAddr = cfAddr;
-                        } else {
-                            popAddr(stackedAddrs, visited, isDone);
-                        }
+                        popAddr(stackedAddrs, visited, isDone);
                     }
                 } else {
-                    if (nextAddr <= endAddr && !visited[nextAddr]) {
-                        curAddr = nextAddr;
+                    if (nextAddr <= endAddr &&
+                        !isDecoded(nextAddr) &&
+                        !visited[nextAddr - decodeBegin]) {
+                        stackedAddrs.push(nextAddr);
+                    }
+                    if (cfAddr >= decodeBegin && cfAddr <= endAddr &&
+                        !visited[cfAddr - decodeBegin]) {
+                        curAddr = cfAddr;
                     } else {
                         popAddr(stackedAddrs, visited, isDone);
                     }
                 }
+            } else {
+                if (nextAddr <= endAddr && !visited[nextAddr - decodeBegin]) {
+                    curAddr = nextAddr;
+                } else {
+                    popAddr(stackedAddrs, visited, isDone);
+                }
+            }
+        }
+    }
 
-            } catch (const std::exception &e) {
-                visited[curAddr] = true;
+    /**
+     * @brief Explores the control flow from startAddr on numThreads threads.
+     * Every branch target is a task on the work-stealing deques, and the
+     * instruction at an address is decoded and formatted only by the thread
+     * that claims the address in an atomic bitmap. The threads follow every
+     * path, so they find every instruction the sequential traversal would
+     * decode. The sequential traversal is then replayed over the decoded
+     * instructions, which resolves overlapping instructions exactly as
+     * with one thread, whatever the order the threads found them in.
+     * @param startAddr The starting address.
+     */
+    void parallelDisas(uint64_t startAddr) {
+        AtomicBitmap claimed(decodeEnd - decodeBegin);
+        WorkStealingQueues queues(numThreads);
+        std::vector<std::vector<std::pair<DecodedInstruction, std::string>>>
+            found(numThreads);
 
-                std::stringstream ss;
-                ss << std::hex << curAddr;
-                std::cerr << ss.str() << ": " << e.what() << std::endl;
-                storeError(curAddr, 1);
+        auto explore = [&](size_t tid, uint64_t addr) {
+            while (addr >= decodeBegin && addr < decodeEnd &&
+                   claimed.claim(addr - decodeBegin)) {
+                State state(binaryBytes.data(), binaryBytes.data() + decodeEnd,
+                            isPadded());
+                DecodedInstruction instruction = state.step(addr);
+                if (instruction.status != DecodeStatus::OK) {
+                    found[tid].emplace_back(instruction, std::string());
+                    addr++;
+                    continue;
+                }
+                found[tid].emplace_back(instruction, format(instruction));
 
-                if (!visited[curAddr + 1] && curAddr + 1 <= endAddr) {
-                    curAddr += 1;
-                } else {
-                    popAddr(stackedAddrs, visited, isDone);
+                if (instruction.mnemonic == Mnemonic::RET) {
+                    return;
+                }
+                addr = instruction.nextAddr();
+                uint64_t cfAddr = instruction.branchTarget();
+                if (isControlFlowInstruction(instruction.mnemonic) &&
+                    cfAddr != addr && cfAddr >= decodeBegin &&
+                    cfAddr < decodeEnd) {
+                    queues.push(tid, cfAddr);
                 }
             }
+        };
+
+        queues.push(0, startAddr);
+        for (size_t i = 0; i < roots.size(); i++) {
+            if (roots[i] >= decodeBegin && roots[i] < decodeEnd) {
+                queues.push(i % numThreads, roots[i]);
+            }
+        }
+        std::vector<std::thread> threads;
+        for (size_t tid = 1; tid < numThreads; tid++) {
+            threads.emplace_back([&, tid]() { queues.run(tid, explore); });
+        }
+        queues.run(0, explore);
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        std::vector<std::pair<DecodedInstruction, std::string>> merged;
+        for (auto &instructions : found) {
+            std::move(instructions.begin(), instructions.end(),
+                      std::back_inserter(merged));
+            std::vector<std::pair<DecodedInstruction, std::string>>().swap(
+                instructions);
+        }
+        std::sort(merged.begin(), merged.end(),
+                  [](const std::pair<DecodedInstruction, std::string> &a,
+                     const std::pair<DecodedInstruction, std::string> &b) {
+                      return a.first.startAddr < b.first.startAddr;
+                  });
+
+        traverse(startAddr, [&]() {
+            auto it = std::lower_bound(
+                merged.begin(), merged.end(), curAddr,
+                [](const std::pair<DecodedInstruction, std::string> &kv,
+                   uint64_t addr) { return kv.first.startAddr < addr; });
+            if (it == merged.end() || it->first.startAddr != curAddr) {
+                return step();
+            }
+            storeDecoded(it->first, it->second);
+            return it->first;
+        });
+    }
+};
+
+/**
+ * @brief The number of equal bytes from which a run of 0x00 or 0xCC is
+ * taken as padding by the hybrid strategy.
+ */
+constexpr size_t MIN_PADDING_RUN = 2;
+
+/**
+ * @struct HybridDisAssembler
+ * @brief Represents a disassembler that runs the recursive descent from the
+ * section start and the roots, then linear-sweeps only the bytes it left
+ * uncovered.
+ */
+struct HybridDisAssembler : public RecursiveDescentDisAssembler {
+    using RecursiveDescentDisAssembler::RecursiveDescentDisAssembler;
+
+    /**
+     * @brief Disassembles instructions using recursive descent, then fills
+     * the gaps using linear sweep.
+     * @param startAddr The starting address.
+     * @param endAddr The ending address.
+     */
+    void disas(uint64_t startAddr, uint64_t endAddr = -1) {
+        descend(startAddr, endAddr);
+        if (decodeBegin >= decodeEnd) {
+            return;
+        }
+
+        // instructions decoded in the gaps must not overlap the code found
+        // by the recursive descent, so the gaps are found before sweeping
+        std::vector<std::pair<uint64_t, uint64_t>> gaps;
+        coverage();
+        for (uint64_t gap = nextGap(decodeBegin, decodeEnd); gap < decodeEnd;
+             gap = nextGap(gap, decodeEnd)) {
+            uint64_t gapEnd =
+                decodeBegin + coverage().findNextSet(gap - decodeBegin,
+                                                     decodeEnd - decodeBegin);
+            gaps.emplace_back(gap, gapEnd);
+            gap = gapEnd;
+        }
+        for (const std::pair<uint64_t, uint64_t> &gap : gaps) {
+            sweepGap(gap.first, gap.second);
+        }
+        flushErrors();
+    }
+
+    /**
+     * @brief Counts the equal bytes at addr if they look like padding
+     * between functions (int3 or zero bytes).
+     * @param addr The starting address.
+     * @param endAddr The address just after the last byte to look at.
+     * @return The length of the padding, or 0 if there is none.
+     */
+    uint64_t paddingLength(uint64_t addr, uint64_t endAddr) const {
+        unsigned char byte = binaryBytes[addr];
+        if (byte != 0x00 && byte != 0xCC) {
+            return 0;
+        }
+        uint64_t end = addr;
+        while (end < endAddr && binaryBytes[end] == byte) {
+            end++;
+        }
+        return end - addr >= MIN_PADDING_RUN || byte == 0xCC ? end - addr : 0;
+    }
+
+   private:
+    /**
+     * @brief Linear-sweeps [gapBegin, gapEnd), skipping padding and the
+     * addresses the recursive descent already failed to decode.
+     * Instructions that would run past the gap are taken as data.
+     * @param gapBegin The first address of the gap.
+     * @param gapEnd The address just after the gap.
+     */
+    void sweepGap(uint64_t gapBegin, uint64_t gapEnd) {
+        curAddr = gapBegin;
+        while (curAddr < gapEnd) {
+            if (visited[curAddr - decodeBegin]) {
+                curAddr++;
+                continue;
+            }
+            uint64_t padding = paddingLength(curAddr, gapEnd);
+            if (padding > 0) {
+                curAddr += padding;
+                continue;
+            }
+
+            State state(binaryBytes.data(), binaryBytes.data() + gapEnd,
+                        isPadded());
+            DecodedInstruction instruction = state.step(curAddr);
+            if (instruction.status == DecodeStatus::OK) {
+                storeInstruction(instruction);
+                curAddr = instruction.nextAddr();
+            } else {
+                errorReport.add(instruction.status, instruction.prefix,
+                                instruction.opcode, instruction.startAddr);
+                storeError(curAddr, 1);
+                curAddr++;
+            }
         }
     }
 };
@@ -1,15 +1,20 @@
 #include <unistd.h>
 
 #include <algorithm>
-#include <fstream>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "disassembler.h"
 #include "header.h"
+#include "mappedfile.h"
+#include "output.h"
 
 const std::vector<std::string> PRINTABLE_SECTIONS = {
     ".plt", ".plt.got", ".plt.sec", ".text", ".init", ".fini"};
@@ -17,60 +22,93 @@ const std::unordered_map<std::string, std::string> SECTION_LABEL_POSTFIX = {
     {".plt", ""},  {".plt.got", "@plt"}, {".plt.sec", "@plt"},
     {".text", ""}, {".init", ""},        {".fini", ""}};
 
-inline void load(const std::string& binaryPath,
-                 std::vector<unsigned char>& binaryBytes) {
-    if (!binaryPath.empty()) {
-        std::ifstream fh(binaryPath, std::ios::binary);
-        if (fh) {
-            // Read the contents of the file into a vector
-            binaryBytes.assign(std::istreambuf_iterator<char>(fh),
-                               std::istreambuf_iterator<char>());
-        } else {
-            throw std::runtime_error("Failed to open object file: " +
-                                     binaryPath);
-        }
-    } else {
+inline std::unique_ptr<MappedFile> load(const std::string& binaryPath) {
+    if (binaryPath.empty()) {
         throw std::runtime_error(
             "Must provide either a file or string containing object code.");
     }
+    std::unique_ptr<MappedFile> file(new MappedFile(binaryPath));
+    return file;
 }
 
-inline std::string getStringFromOffset(const std::vector<unsigned char>& x,
-                                       size_t i) {
-    std::string result;
-    while (i < x.size() && x[i] != '\0') {
-        result += x[i];
-        ++i;
+// the NUL-terminated string at i, viewed in place; it ends at the end of x
+// if no NUL follows
+inline std::string_view getStringFromOffset(ByteSpan x, size_t i) {
+    if (i >= x.size()) {
+        return std::string_view();
     }
-    return result;
+    const char* begin = reinterpret_cast<const char*>(x.data()) + i;
+    const void* nul = std::memchr(begin, '\0', x.size() - i);
+    size_t length = nul != nullptr ? static_cast<const char*>(nul) - begin
+                                   : x.size() - i;
+    return std::string_view(begin, length);
 }
 
 struct ELFDisAssembler {
     std::string binaryPath;
     std::string strategy;
 
-    std::vector<unsigned char> binaryBytes;
+    std::unique_ptr<MappedFile> file;
+    ByteSpan binaryBytes;
     DisAssembler* da;
 
     ELF64_FILE_HEADER header;
-    ELF64_SECTION_HEADER shstr;
-    std::unordered_map<std::string, ELF64_SECTION_HEADER> section_headers;
-    std::unordered_map<uint64_t, std::string> addr2symbol;
-    std::unordered_map<int, std::string> pltIdx2symbol;
+    ELF64_SECTION_HEADER shstr = {};
+    uint64_t numSections = 0;
+    // the sections in index order, and the index of each name (the first
+    // section of that name)
+    std::vector<ELF64_SECTION_HEADER> section_list;
+    std::vector<std::string> section_names;
+    std::unordered_map<std::string, size_t> section_index;
+
+    // the printable sections sorted by offset, for finding the section of
+    // an address
+    struct PrintableSection {
+        uint64_t begin;
+        uint64_t end;
+        std::string name;
+        bool printed;
+    };
+    std::vector<PrintableSection> printableSections;
+    // the sections with bytes in the file sorted by virtual address, for
+    // translating addresses into offsets
+    struct MappedSection {
+        uint64_t addr;
+        uint64_t end;
+        uint64_t offset;
+    };
+    std::vector<MappedSection> mappedSections;
+    std::vector<uint64_t> funcAddrs;
+    SymbolIndex addr2symbol;
+    std::unordered_map<uint64_t, std::string_view> pltIdx2symbol;
     std::unordered_map<uint64_t, uint64_t> addr2roffset;
-    std::unordered_map<int, uint64_t> pltIdx2roffset;
+    std::unordered_map<uint64_t, uint64_t> pltIdx2roffset;
 
-    ELFDisAssembler(std::string binaryPath, std::string strategy)
+    std::string postprefix;
+    size_t nextSection = 0;
+    size_t nextSymbol = 0;
+    uint64_t lastPrintedAddr = 0;
+    OutputSink out;
+
+    ELFDisAssembler(std::string binaryPath, std::string strategy,
+                    size_t numThreads = 1)
         : binaryPath(binaryPath), strategy(strategy) {
-        load(binaryPath, binaryBytes);
+        file = load(binaryPath);
+        // the zero page after the mapping pads the fast path of the decoder
+        binaryBytes = file->bytes(DECODE_PADDING);
 
         _parseFileHeader();
         _parseSectionHeader();
+        _indexPrintableSections();
+        _indexMappedSections();
         _parseSymTabSection();
         _parseDynSymSection();
+        _parseDynSymFunctions();
         _parsePltSecSection();
+        addr2symbol.sort();
 
         _prepareDA();
+        da->numThreads = numThreads;
     }
 
     void _prepareDA() {
@@ -78,10 +116,13 @@ struct ELFDisAssembler {
             da = new LinearSweepDisAssembler(binaryBytes, addr2symbol);
         } else if (strategy == "rd" || strategy == "recursivedescent") {
             da = new RecursiveDescentDisAssembler(binaryBytes, addr2symbol);
+        } else if (strategy == "hy" || strategy == "hybrid") {
+            da = new HybridDisAssembler(binaryBytes, addr2symbol);
         } else {
             std::cerr << strategy
                       << " is not supported as a valid strategy. We currently "
-                         "support [linearsweep (ls), recursivedescent (rd)].";
+                         "support [linearsweep (ls), recursivedescent (rd), "
+                         "hybrid (hy)].";
             std::cerr << "The default strategy (linearsweep) is used for the "
                          "following task."
                       << std::endl;
@@ -89,145 +130,334 @@ struct ELFDisAssembler {
         }
     }
 
+    // the header of the first section with the given name, or nullptr
+    const ELF64_SECTION_HEADER* findSection(
+        const std::string& section_name) const {
+        auto it = section_index.find(section_name);
+        if (it == section_index.end()) {
+            return nullptr;
+        }
+        return &section_list[it->second];
+    }
+
     void disas(std::string section_name = ".text") {
-        if (section_headers.find(section_name) != section_headers.end()) {
-            da->disas((uint64_t)section_headers[section_name].sh_offset,
-                      (uint64_t)section_headers[section_name].sh_offset +
-                          (uint64_t)section_headers[section_name].sh_size - 1);
+        const ELF64_SECTION_HEADER* sh = findSection(section_name);
+        if (sh != nullptr) {
+            if (strategy != "ls" && strategy != "linearsweep" &&
+                da->roots.empty()) {
+                // every traversal starts from all roots in its section
+                da->roots = _collectRoots();
+            }
+            file->willNeed(sh->sh_offset, sh->sh_size);
+            da->disas(sh->sh_offset, sh->sh_offset + sh->sh_size - 1);
+        }
+    }
+
+    ByteSpan sectionBytes(const std::string& section_name) {
+        const ELF64_SECTION_HEADER* sh = findSection(section_name);
+        if (sh == nullptr) {
+            return ByteSpan();
+        }
+        return file->bytes().subspan(sh->sh_offset, sh->sh_size);
+    }
+
+    void disasAll() {
+        for (const std::string& s : PRINTABLE_SECTIONS) {
+            disas(s);
         }
     }
 
     void print() {
-        std::vector<std::pair<uint64_t, uint64_t>> disassembledPositionsVec(
-            da->disassembledPositions.begin(), da->disassembledPositions.end());
-        std::sort(disassembledPositionsVec.begin(),
-                  disassembledPositionsVec.end());
+        for (const InstructionRecord& k : da->instructions.ordered()) {
+            printInstruction(k, da->maxInstructionStrSize);
+        }
+        printFooter();
+    }
 
-        std::string postprefix = "";
+    // prints each section as soon as it is decoded, padding the instruction
+    // text to a fixed width instead of the width of the longest one
+    void streamPrint(size_t width) {
+        for (const PrintableSection& s : printableSections) {
+            disas(s.name);
+            for (const InstructionRecord& k : da->instructions.ordered()) {
+                printInstruction(k, width);
+            }
+            da->instructions.clear();
+            out.flush();
+        }
+        printFooter();
+    }
 
-        std::unordered_map<std::string, bool> done;
+    void printInstruction(const InstructionRecord& k, size_t width) {
+        // instructions mostly arrive in address order, so the sections and
+        // the symbols are walked with cursors in one merged pass. The
+        // cursors are re-seeked when an address steps back
+        if (k.startAddr < lastPrintedAddr) {
+            nextSection = _sectionAt(k.startAddr);
+            nextSymbol = addr2symbol.lowerBound(k.startAddr);
+        }
+        lastPrintedAddr = k.startAddr;
+
+        while (nextSection < printableSections.size() &&
+               printableSections[nextSection].end <= k.startAddr) {
+            nextSection++;
+        }
+        if (nextSection < printableSections.size() &&
+            printableSections[nextSection].begin <= k.startAddr) {
+            PrintableSection& section = printableSections[nextSection];
+            if (!section.printed) {
+                out.write("\nsection: ").write(section.name).write(" ----\n");
+                section.printed = true;
+                postprefix = SECTION_LABEL_POSTFIX.at(section.name);
+            }
+        }
+
+        while (nextSymbol < addr2symbol.size() &&
+               addr2symbol.address(nextSymbol) < k.startAddr) {
+            nextSymbol++;
+        }
+        if (nextSymbol < addr2symbol.size() &&
+            addr2symbol.address(nextSymbol) == k.startAddr) {
+            out.put('\n').hex(k.startAddr).write(" <");
+            out.write(addr2symbol.name(nextSymbol));
+            out.write(postprefix).write(">:");
+            auto roffset = addr2roffset.find(k.startAddr);
+            if (roffset != addr2roffset.end()) {
+                out.write(" #").hex(roffset->second);
+            }
+            out.put('\n');
+        }
+        out.put(' ').hex(k.startAddr).write(": ").write(k.text);
+        out.fill(' ', width > k.text.size() ? width - k.text.size() : 0);
+
+        out.write(" ( ");
+        for (uint64_t i = k.startAddr; i < k.endAddr; i++) {
+            out.hexByte(da->binaryBytes[i]).put(' ');
+        }
+        out.write(")\n");
+    }
+
+    void printFooter() {
+        out.write("-------------------\nDone!\n");
+        out.flush();
+    }
+
+    void printErrorReport() { da->errorReport.print(std::cerr); }
+
+    // sorts the printable sections by offset, keeping the order of
+    // PRINTABLE_SECTIONS for sections at the same offset
+    void _indexPrintableSections() {
         for (const std::string& s : PRINTABLE_SECTIONS) {
-            done.insert(std::make_pair(s, false));
-        }
-
-        for (const std::pair<size_t, size_t>& k : disassembledPositionsVec) {
-            for (const std::string& s : PRINTABLE_SECTIONS) {
-                if ((section_headers.find(s) != section_headers.end()) &&
-                    (k.first >= section_headers[s].sh_offset) &&
-                    (k.first < section_headers[s].sh_offset +
-                                   section_headers[s].sh_size)) {
-                    if (!done[s]) {
-                        std::cout << std::endl
-                                  << "section: " << s << " ----" << std::endl;
-                        done[s] = true;
-                        postprefix = SECTION_LABEL_POSTFIX.at(s);
-                    }
-                }
+            const ELF64_SECTION_HEADER* sh = findSection(s);
+            if (sh != nullptr) {
+                printableSections.push_back(PrintableSection{
+                    sh->sh_offset, sh->sh_offset + sh->sh_size, s, false});
             }
+        }
+        std::stable_sort(
+            printableSections.begin(), printableSections.end(),
+            [](const PrintableSection& a, const PrintableSection& b) {
+                return a.begin < b.begin;
+            });
+    }
 
-            if (da->disassembledInstructions.find(k) !=
-                da->disassembledInstructions.end()) {
-                if (addr2symbol.find(k.first) != addr2symbol.end()) {
-                    std::cout << std::endl
-                              << std::hex << k.first << " <"
-                              << addr2symbol.at(k.first) << postprefix + ">:";
-                    if (addr2roffset.find(k.first) != addr2roffset.end()) {
-                        std::cout << " #" << addr2roffset[k.first];
-                    }
-
-                    std::cout << std::endl;
-                }
-                std::cout << " " << std::hex << k.first << ": ";
-                std::cout << da->disassembledInstructions.at(k);
-                std::cout << std::string(
-                    da->maxInstructionStrSize -
-                        da->disassembledInstructions.at(k).size(),
-                    ' ');
-
-                std::cout << " ( ";
-                for (int i = k.first; i < k.second; i++) {
-                    std::cout << std::hex << (int)da->binaryBytes[i] << " ";
+    // the index of the first printable section that ends after addr
+    size_t _sectionAt(uint64_t addr) const {
+        return std::partition_point(
+                   printableSections.begin(), printableSections.end(),
+                   [&](const PrintableSection& s) { return s.end <= addr; }) -
+               printableSections.begin();
+    }
+
+    // sorts the sections that have bytes in the file by address. Sections
+    // without them (e.g. .tbss, which overlaps the sections after it) are
+    // left out, and of sections at the same address the first one is kept
+    void _indexMappedSections() {
+        for (const ELF64_SECTION_HEADER& sh : section_list) {
+            if (sh.sh_type != ELF_SHT_NOBITS && sh.sh_addr != 0 &&
+                sh.sh_size != 0) {
+                mappedSections.push_back(MappedSection{
+                    sh.sh_addr, sh.sh_addr + sh.sh_size, sh.sh_offset});
+            }
+        }
+        std::stable_sort(mappedSections.begin(), mappedSections.end(),
+                         [](const MappedSection& a, const MappedSection& b) {
+                             return a.addr < b.addr;
+                         });
+        mappedSections.erase(
+            std::unique(mappedSections.begin(), mappedSections.end(),
+                        [](const MappedSection& a, const MappedSection& b) {
+                            return a.addr == b.addr;
+                        }),
+            mappedSections.end());
+    }
+
+    // translates a virtual address into a file offset through the section
+    // that contains it, or returns -1 if no section does
+    uint64_t _vaddrToOffset(uint64_t vaddr) const {
+        auto it = std::upper_bound(mappedSections.begin(),
+                                   mappedSections.end(), vaddr,
+                                   [](uint64_t addr, const MappedSection& s) {
+                                       return addr < s.addr;
+                                   });
+        if (it == mappedSections.begin() || vaddr >= (--it)->end) {
+            return -1;
+        }
+        return vaddr - it->addr + it->offset;
+    }
+
+    // the starting addresses of the recursive descent: the printable
+    // sections, the functions, the entry point and the pointers of
+    // .init_array and .fini_array
+    std::vector<uint64_t> _collectRoots() {
+        std::vector<uint64_t> roots = funcAddrs;
+        for (const PrintableSection& s : printableSections) {
+            roots.push_back(s.begin);
+        }
+        if (header.e_entry != 0) {
+            roots.push_back(_vaddrToOffset(header.e_entry));
+        }
+        for (const char* s : {".init_array", ".fini_array"}) {
+            const ELF64_SECTION_HEADER* array = findSection(s);
+            if (array == nullptr) {
+                continue;
+            }
+            for (uint64_t i = 0; i + sizeof(uint64_t) <= array->sh_size;
+                 i += sizeof(uint64_t)) {
+                uint64_t ptr;
+                _read(array->sh_offset + i, ptr, "an init/fini array entry");
+                if (ptr != 0 && ptr != (uint64_t)-1) {
+                    roots.push_back(_vaddrToOffset(ptr));
                 }
-                std::cout << ")" << std::endl;
             }
         }
-        std::cout << "-------------------" << std::endl;
-        std::cout << "Done!" << std::endl;
+        roots.erase(std::remove(roots.begin(), roots.end(), (uint64_t)-1),
+                    roots.end());
+        std::sort(roots.begin(), roots.end());
+        roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+        return roots;
+    }
+
+    // throws if [offset, offset + size) does not lie within the file
+    void _checkRange(uint64_t offset, uint64_t size, std::string_view what) {
+        if (offset > file->size() || size > file->size() - offset) {
+            throw std::runtime_error("Malformed ELF file: " +
+                                     std::string(what) +
+                                     " lies outside of the file");
+        }
+    }
+
+    template <typename T>
+    void _read(uint64_t offset, T& value, std::string_view what) {
+        _checkRange(offset, sizeof(T), what);
+        std::copy_n(binaryBytes.begin() + offset, sizeof(T),
+                    reinterpret_cast<unsigned char*>(&value));
+    }
+
+    // the name at idx of a string table, viewed in the mapped file, or ""
+    // if idx is out of the table
+    std::string_view _stringAt(const ELF64_SECTION_HEADER& strtab,
+                               uint64_t idx) {
+        return getStringFromOffset(
+            binaryBytes.subspan(strtab.sh_offset, strtab.sh_size), idx);
     }
 
     void _parseFileHeader() {
-        std::copy_n(binaryBytes.begin(), sizeof(header),
-                    reinterpret_cast<unsigned char*>(&header));
-        std::copy_n(binaryBytes.begin() + (int)header.e_shoff +
-                        (int)header.e_shstrndx * (int)header.e_shentsize,
-                    sizeof(shstr), reinterpret_cast<unsigned char*>(&shstr));
+        _read(0, header, "the file header");
+        if (header.e_shoff == 0) {
+            return;
+        }
+        // files with too many sections keep the number of sections and the
+        // index of .shstrtab in section 0
+        ELF64_SECTION_HEADER first;
+        _read(header.e_shoff, first, "the section header table");
+        numSections = header.e_shnum != 0 ? header.e_shnum : first.sh_size;
+        uint64_t shstrndx = header.e_shstrndx != ELF_SHN_XINDEX
+                                ? header.e_shstrndx
+                                : first.sh_link;
+        if (header.e_shentsize < sizeof(ELF64_SECTION_HEADER) ||
+            numSections > file->size() / header.e_shentsize) {
+            throw std::runtime_error(
+                "Malformed ELF file: invalid section header table");
+        }
+        _checkRange(header.e_shoff, numSections * header.e_shentsize,
+                    "the section header table");
+        if (shstrndx >= numSections) {
+            throw std::runtime_error(
+                "Malformed ELF file: invalid section name table");
+        }
+        _read(header.e_shoff + shstrndx * header.e_shentsize, shstr,
+              "the section name table");
+        _checkRange(shstr.sh_offset, shstr.sh_size, "the section name table");
     }
 
     void _parseSectionHeader() {
-        for (int sid = 0; sid < (int)header.e_shnum; sid++) {
+        for (uint64_t sid = 0; sid < numSections; sid++) {
             ELF64_SECTION_HEADER sh;
-            std::copy_n(binaryBytes.begin() + (int)header.e_shoff +
-                            sid * (int)header.e_shentsize,
-                        sizeof(sh), reinterpret_cast<unsigned char*>(&sh));
-            std::string section_name = getStringFromOffset(
-                binaryBytes, (int)shstr.sh_offset + (int)sh.sh_name);
-            section_headers.insert(std::make_pair(section_name, sh));
+            _read(header.e_shoff + sid * header.e_shentsize, sh,
+                  "a section header");
+            std::string section_name(_stringAt(shstr, sh.sh_name));
+            if (sh.sh_type != ELF_SHT_NOBITS) {
+                _checkRange(sh.sh_offset, sh.sh_size,
+                            "section " + section_name);
+            }
+            section_index.emplace(section_name, section_list.size());
+            section_list.push_back(sh);
+            section_names.push_back(section_name);
         }
     }
 
     void _parseSymTabSection() {
         // parse the .symtab section
-        if (section_headers.find(".symtab") != section_headers.end() &&
-            section_headers.find(".strtab") != section_headers.end()) {
-            int symtab_symbol_num = (int)section_headers[".symtab"].sh_size /
-                                    (int)(sizeof(ELF64_SYM));
-            for (int sid = 0; sid < symtab_symbol_num; sid++) {
+        const ELF64_SECTION_HEADER* symtabSection = findSection(".symtab");
+        const ELF64_SECTION_HEADER* strtabSection = findSection(".strtab");
+        if (symtabSection != nullptr && strtabSection != nullptr) {
+            const ELF64_SECTION_HEADER& symtab = *symtabSection;
+            const ELF64_SECTION_HEADER& strtab = *strtabSection;
+            uint64_t symtab_symbol_num = symtab.sh_size / sizeof(ELF64_SYM);
+            for (uint64_t sid = 0; sid < symtab_symbol_num; sid++) {
                 ELF64_SYM sym;
-                std::copy_n(binaryBytes.begin() +
-                                (int)section_headers[".symtab"].sh_offset +
-                                sid * sizeof(ELF64_SYM),
-                            sizeof(sym),
-                            reinterpret_cast<unsigned char*>(&sym));
+                _read(symtab.sh_offset + sid * sizeof(ELF64_SYM), sym,
+                      "a symbol");
 
-                std::string sym_name = getStringFromOffset(
-                    binaryBytes, (int)section_headers[".strtab"].sh_offset +
-                                     (int)sym.st_name);
+                std::string_view sym_name = _stringAt(strtab, sym.st_name);
 
-                if (sym_name.size() > 0) {
-                    addr2symbol.insert(std::make_pair(
-                        (uint64_t)((long long)section_headers[".text"]
-                                       .sh_offset +
-                                   (long long)sym.st_value),
-                        sym_name));
+                uint64_t offset = _symbolOffset(sym);
+                if (sym_name.size() > 0 && offset != (uint64_t)-1) {
+                    addr2symbol.addView(offset, sym_name);
+                }
+                if (elfSymType(sym) == ELF_STT_FUNC && offset != (uint64_t)-1) {
+                    funcAddrs.push_back(offset);
                 }
             }
         }
     }
 
     void _parseDynSymSection() {
-        if (section_headers.find(".rela.plt") != section_headers.end() &&
-            section_headers.find(".dynsym") != section_headers.end() &&
-            section_headers.find(".dynstr") != section_headers.end()) {
-            int rela_num = (int)section_headers[".rela.plt"].sh_size /
-                           (int)(sizeof(ELF64_RELA));
-            for (int sid = 0; sid < rela_num; sid++) {
+        const ELF64_SECTION_HEADER* relapltSection = findSection(".rela.plt");
+        const ELF64_SECTION_HEADER* dynsymSection = findSection(".dynsym");
+        const ELF64_SECTION_HEADER* dynstrSection = findSection(".dynstr");
+        if (relapltSection != nullptr && dynsymSection != nullptr &&
+            dynstrSection != nullptr) {
+            const ELF64_SECTION_HEADER& relaplt = *relapltSection;
+            const ELF64_SECTION_HEADER& dynsym = *dynsymSection;
+            const ELF64_SECTION_HEADER& dynstr = *dynstrSection;
+            uint64_t rela_num = relaplt.sh_size / sizeof(ELF64_RELA);
+            uint64_t dynsym_num = dynsym.sh_size / sizeof(ELF64_SYM);
+            for (uint64_t sid = 0; sid < rela_num; sid++) {
                 ELF64_RELA rela;
-                std::copy_n(binaryBytes.begin() +
-                                (int)section_headers[".rela.plt"].sh_offset +
-                                sid * sizeof(ELF64_RELA),
-                            sizeof(rela),
-                            reinterpret_cast<unsigned char*>(&rela));
+                _read(relaplt.sh_offset + sid * sizeof(ELF64_RELA), rela,
+                      "a relocation");
+                uint64_t symIdx = rela.r_info >> 32;
+                if (symIdx >= dynsym_num) {
+                    continue;
+                }
 
                 ELF64_SYM sym;
-                std::copy_n(binaryBytes.begin() +
-                                (int)section_headers[".dynsym"].sh_offset +
-                                (rela.r_info >> 32) * sizeof(ELF64_SYM),
-                            sizeof(sym),
-                            reinterpret_cast<unsigned char*>(&sym));
-
-                std::string sym_name = getStringFromOffset(
-                    binaryBytes, (int)section_headers[".dynstr"].sh_offset +
-                                     (int)sym.st_name);
+                _read(dynsym.sh_offset + symIdx * sizeof(ELF64_SYM), sym,
+                      "a symbol");
+
+                std::string_view sym_name = _stringAt(dynstr, sym.st_name);
                 if (sym_name.size() > 0) {
                     pltIdx2symbol.insert(std::make_pair(sid, sym_name));
                     pltIdx2roffset.insert(std::make_pair(sid, rela.r_offset));
@@ -236,17 +466,51 @@ struct ELFDisAssembler {
         }
     }
 
+    // the defined functions of .dynsym are roots of the recursive descent,
+    // which matters for stripped binaries
+    void _parseDynSymFunctions() {
+        const ELF64_SECTION_HEADER* dynsymSection = findSection(".dynsym");
+        if (dynsymSection != nullptr) {
+            const ELF64_SECTION_HEADER& dynsym = *dynsymSection;
+            uint64_t dynsym_symbol_num = dynsym.sh_size / sizeof(ELF64_SYM);
+            for (uint64_t sid = 0; sid < dynsym_symbol_num; sid++) {
+                ELF64_SYM sym;
+                _read(dynsym.sh_offset + sid * sizeof(ELF64_SYM), sym,
+                      "a symbol");
+                uint64_t offset = _symbolOffset(sym);
+                if (elfSymType(sym) == ELF_STT_FUNC && offset != (uint64_t)-1) {
+                    funcAddrs.push_back(offset);
+                }
+            }
+        }
+    }
+
+    // translates the value of a symbol into a file offset, or returns -1 if
+    // the symbol is undefined or absolute. st_value is an offset into the
+    // section of the symbol in relocatable objects, and a virtual address
+    // otherwise
+    uint64_t _symbolOffset(const ELF64_SYM& sym) {
+        if (sym.st_shndx == ELF_SHN_UNDEF ||
+            sym.st_shndx >= ELF_SHN_LORESERVE ||
+            sym.st_shndx >= section_list.size()) {
+            return -1;
+        }
+        if (header.e_type == ELF_ET_REL) {
+            return section_list[sym.st_shndx].sh_offset + sym.st_value;
+        }
+        return _vaddrToOffset(sym.st_value);
+    }
+
     void _parsePltSecSection() {
-        if (section_headers.find(".plt.sec") != section_headers.end()) {
-            for (const std::pair<int, std::string> kv : pltIdx2symbol) {
-                addr2symbol.insert(
-                    std::make_pair(section_headers[".plt.sec"].sh_offset +
-                                       kv.first * PLT_SEC_ENTRY_SIZE,
-                                   kv.second));
-                addr2roffset.insert(
-                    std::make_pair(section_headers[".plt.sec"].sh_offset +
-                                       kv.first * PLT_SEC_ENTRY_SIZE,
-                                   pltIdx2roffset[kv.first]));
+        const ELF64_SECTION_HEADER* pltsec = findSection(".plt.sec");
+        if (pltsec != nullptr) {
+            for (const auto& kv : pltIdx2symbol) {
+                addr2symbol.addView(
+                    pltsec->sh_offset + kv.first * PLT_SEC_ENTRY_SIZE,
+                    kv.second);
+                addr2roffset.insert(std::make_pair(
+                    pltsec->sh_offset + kv.first * PLT_SEC_ENTRY_SIZE,
+                    pltIdx2roffset[kv.first]));
             }
         }
     }
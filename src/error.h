@@ -1,21 +1,116 @@
-#include <stdexcept>
+/**
+ * @file
+ * @brief Defines the decode status codes and the aggregated error report.
+ */
+
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <map>
 #include <string>
+#include <tuple>
+#include <vector>
 
-class OPCODE_LOOKUP_ERROR : public std::runtime_error {
-   public:
-    OPCODE_LOOKUP_ERROR(const std::string& message)
-        : std::runtime_error(message) {}
-};
+#include "constants.h"
 
-class OPERAND_LOOKUP_ERROR : public std::runtime_error {
-   public:
-    OPERAND_LOOKUP_ERROR(const std::string& message)
-        : std::runtime_error(message) {}
+/**
+ * @brief The result of decoding an instruction.
+ */
+enum class DecodeStatus : uint8_t {
+    OK,               /**< The instruction is decoded */
+    UNKNOWN_OPCODE,   /**< Unknown combination of the prefix and the opcode */
+    UNKNOWN_OPERAND,  /**< No operand information for the opcode */
+    INVALID_OPERAND,  /**< The operand information is malformed */
+    TRUNCATED,        /**< The object code ends inside the instruction */
+    TOO_LONG,         /**< The instruction is longer than 15 bytes */
 };
 
-class InvalidOperandError : public std::runtime_error {
-   public:
-    InvalidOperandError(const std::string& message)
-        : std::runtime_error(message) {}
-};
+inline std::string to_string(DecodeStatus status) {
+    switch (status) {
+        case DecodeStatus::OK:
+            return "ok";
+        case DecodeStatus::UNKNOWN_OPCODE:
+            return "unknown opcode";
+        case DecodeStatus::UNKNOWN_OPERAND:
+            return "unknown operand";
+        case DecodeStatus::INVALID_OPERAND:
+            return "invalid operand";
+        case DecodeStatus::TRUNCATED:
+            return "truncated instruction";
+        case DecodeStatus::TOO_LONG:
+            return "instruction too long";
+        default:
+            return "unknown";
+    }
+}
+
+/**
+ * @struct DecodeErrorReport
+ * @brief Aggregates decode failures per (status, prefix, opcode), so that
+ * they can be reported once instead of one line per failing byte.
+ */
+struct DecodeErrorReport {
+    /**
+     * @brief The number of addresses kept for each kind of failure.
+     */
+    static constexpr size_t MAX_SAMPLE_ADDRS = 8;
+
+    /**
+     * @struct Entry
+     * @brief The failures of one (status, prefix, opcode).
+     */
+    struct Entry {
+        uint64_t count = 0;          /**< The number of failures */
+        std::vector<uint64_t> addrs; /**< The first few addresses */
+    };
 
+    std::map<std::tuple<DecodeStatus, Prefix, int>, Entry>
+        entries;        /**< Failures grouped by (status, prefix, opcode) */
+    uint64_t total = 0; /**< The total number of failures */
+
+    /**
+     * @brief Records a failure.
+     * @param status Why decoding failed.
+     * @param prefix The prefix used to look up the opcode.
+     * @param opcode The opcode.
+     * @param addr The starting address of the instruction.
+     */
+    void add(DecodeStatus status, Prefix prefix, int opcode, uint64_t addr) {
+        Entry& entry = entries[std::make_tuple(status, prefix, opcode)];
+        if (entry.addrs.size() < MAX_SAMPLE_ADDRS) {
+            entry.addrs.emplace_back(addr);
+        }
+        entry.count++;
+        total++;
+    }
+
+    /**
+     * @brief Checks whether no failure has been recorded.
+     * @return True if there is no failure.
+     */
+    bool empty() const { return total == 0; }
+
+    /**
+     * @brief Prints the report, one line per (status, prefix, opcode).
+     * @param os The output stream.
+     */
+    void print(std::ostream& os) const {
+        if (empty()) {
+            return;
+        }
+        os << std::dec << total << " decode errors" << std::endl;
+        for (const auto& kv : entries) {
+            os << "  " << to_string(std::get<0>(kv.first)) << " ("
+               << to_string(std::get<1>(kv.first)) << ", " << std::hex
+               << std::get<2>(kv.first) << "): " << std::dec << kv.second.count
+               << " at";
+            for (uint64_t addr : kv.second.addrs) {
+                os << " " << std::hex << addr;
+            }
+            if (kv.second.count > kv.second.addrs.size()) {
+                os << " ...";
+            }
+            os << std::dec << std::endl;
+        }
+    }
+};
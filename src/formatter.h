@@ -0,0 +1,275 @@
+/**
+ * @file
+ * @brief Defines functions for converting decoded instructions into text.
+ */
+
+#pragma once
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "bytes.h"
+#include "constants.h"
+#include "instruction.h"
+#include "symbols.h"
+
+/**
+ * @brief Formats a displacement as a signed offset, e.g. " + 0x10".
+ * @param disp The sign-extended displacement.
+ * @param width The number of hex digits of a positive displacement.
+ * @return The formatted displacement.
+ */
+inline std::string formatDisp(int32_t disp, int width) {
+    std::stringstream ss;
+    if (disp < 0) {
+        ss << " - 0x" << std::hex << (-1 * static_cast<int64_t>(disp));
+    } else {
+        ss << " + 0x" << std::hex << std::setw(width) << std::setfill('0')
+           << disp;
+    }
+    return ss.str();
+}
+
+/**
+ * @brief Formats an immediate as a zero-padded hex string, e.g. "0x0010".
+ * @param imm The immediate.
+ * @param size The size of the immediate in bytes.
+ * @return The formatted immediate.
+ */
+inline std::string formatImm(uint64_t imm, int size) {
+    std::stringstream ss;
+    ss << "0x" << std::hex << std::setw(size * 2) << std::setfill('0') << imm;
+    return ss.str();
+}
+
+/**
+ * @brief Gets the text of the instruction prefix (e.g. lock or rep).
+ * @param instruction The decoded instruction.
+ * @return The prefix text, or an empty string if there is no prefix.
+ */
+inline std::string formatInstructionPrefix(
+    const DecodedInstruction& instruction) {
+    switch (instruction.instructionPrefix) {
+        case 0xF0:
+            return "lock";
+        case 0xF2:
+            return isControlFlowInstruction(instruction.mnemonic) ? "bnd"
+                                                                  : "repne";
+        case 0xF3:
+            return "rep";
+        case 0x3E:
+            return "notrack";
+        default:
+            return "";
+    }
+}
+
+/**
+ * @brief Gets the text of the memory operand (or the register operand of mod
+ * 3) encoded by the ModRM byte without SIB, e.g. "[rbp + 0x10]".
+ * @param instruction The decoded instruction.
+ * @param kind The type of the operand.
+ * @return The operand text.
+ */
+inline std::string formatModRMAddr(const DecodedInstruction& instruction,
+                                   Operand kind) {
+    const ModRM& modrm = MODRM_TABLE[instruction.modrm];
+    int rm = modrm.rmByte | rexB(instruction.rex);
+    // memory-only operands (e.g. of lea) have no register set of their own
+    // if they are encoded with mod 3
+    const std::vector<std::string>* registers =
+        modrm.modByte == 3 && operand2register(kind) != nullptr
+            ? operand2register(kind)
+            : &REGISTERS64;
+    std::string addrBaseReg = kind == Operand::xm128
+                                  ? "xmm" + std::to_string(rm)
+                                  : registers->at(rm);
+
+    if (modrm.isRipRel) {
+        return "[rip" + formatDisp(instruction.disp, 8) + "]";
+    }
+    switch (modrm.modByte) {
+        case 0:
+            return "[" + addrBaseReg + "]";
+        case 1:
+            return "[" + addrBaseReg + formatDisp(instruction.disp, 1) + "]";
+        case 2:
+            return "[" + addrBaseReg + formatDisp(instruction.disp, 8) + "]";
+        default:
+            return addrBaseReg;
+    }
+}
+
+/**
+ * @brief Gets the text of the memory operand encoded by the SIB byte, e.g.
+ * "[rax + rcx * 4 - 0x10]".
+ * @param instruction The decoded instruction.
+ * @return The operand text.
+ */
+inline std::string formatSIBAddr(const DecodedInstruction& instruction) {
+    const ModRM& modrm = MODRM_TABLE[instruction.modrm];
+    const SIB& sib = SIB_TABLE[instruction.sib];
+    std::string addrBaseReg;
+    std::string offset;
+
+    if (instruction.base == NO_REG) {
+        // no base register; the 32-bit displacement is the base
+        std::stringstream ss;
+        if (instruction.disp < 0) {
+            ss << "-0x" << std::hex
+               << (-1 * static_cast<int64_t>(instruction.disp));
+        } else {
+            ss << "0x" << std::hex << std::setw(8) << std::setfill('0')
+               << instruction.disp;
+        }
+        addrBaseReg = ss.str();
+        if (sib.indexByte == 4) {
+            return addrBaseReg;
+        }
+    } else {
+        addrBaseReg = REGISTERS64.at(instruction.base);
+        if (modrm.modByte == 1) {
+            offset = formatDisp(instruction.disp, 1);
+        } else if (modrm.modByte == 2) {
+            offset = formatDisp(instruction.disp, 8);
+        }
+    }
+
+    if (instruction.index == NO_REG) {
+        return "[" + addrBaseReg + offset + "]";
+    }
+    return "[" + addrBaseReg + " + " + REGISTERS64.at(instruction.index) +
+           " * " + std::to_string(instruction.scale) + offset + "]";
+}
+
+/**
+ * @brief Gets the text of an operand.
+ * @param instruction The decoded instruction.
+ * @param idx The index of the operand.
+ * @return The operand text.
+ */
+inline std::string formatOperand(const DecodedInstruction& instruction,
+                                 int idx) {
+    const DecodedOperand& operand = instruction.operands[idx];
+    Operand kind = operand.kind;
+    std::string decodedOperandStr;
+
+    if (isA_REG(kind) || kind == Operand::cl || kind == Operand::dx) {
+        decodedOperandStr = to_string(kind);
+    } else if (kind == Operand::sti) {
+        decodedOperandStr = "st(" + std::to_string(operand.reg) + ")";
+    } else if (isRM(kind) || isREG(kind) || isM(kind)) {
+        if ((isRM(kind) || isM(kind)) && instruction.hasModrm) {
+            decodedOperandStr = instruction.hasSib
+                                    ? formatSIBAddr(instruction)
+                                    : formatModRMAddr(instruction, kind);
+        } else if (kind == Operand::xmm || kind == Operand::xm128) {
+            decodedOperandStr = "xmm" + std::to_string(operand.reg);
+        } else if (operand2register(kind) != nullptr) {
+            decodedOperandStr = operand2register(kind)->at(operand.reg);
+        }
+
+        if (instruction.segmentPrefix == 0x64) {
+            decodedOperandStr = "fs:" + decodedOperandStr;
+        } else if (instruction.segmentPrefix == 0x65) {
+            decodedOperandStr = "gs:" + decodedOperandStr;
+        }
+    } else if (isIMM(kind)) {
+        decodedOperandStr = formatImm(instruction.imm, instruction.immSize);
+    }
+
+    return decodedOperandStr;
+}
+
+/**
+ * @brief Appends the lowercase hex digits of a number without leading zeros,
+ * e.g. "401a".
+ * @param out The string to append to.
+ * @param value The number.
+ */
+inline void appendHex(std::string& out, uint64_t value) {
+    char digits[16];
+    char* end = digits + sizeof(digits);
+    char* cur = end;
+    do {
+        *--cur = "0123456789abcdef"[value & 0xF];
+        value >>= 4;
+    } while (value != 0);
+    out.append(cur, end - cur);
+}
+
+/**
+ * @brief Appends the text of a decoded instruction to a string, so that a
+ * buffer can be reused for many instructions.
+ * @param out The string to append to.
+ * @param instruction The decoded instruction.
+ * @param addr2symbol The symbols, used to label the targets of jumps and
+ * calls.
+ * @param scopeBegin The start of the range (e.g. the section) whose
+ * targets are labelled by the nearest preceding symbol in the range, e.g.
+ * <func+0x1c>. Other targets are labelled only by an exact symbol.
+ * @param scopeEnd The end of the range (exclusive).
+ */
+inline void appendInstruction(std::string& out,
+                              const DecodedInstruction& instruction,
+                              const SymbolIndex& addr2symbol,
+                              uint64_t scopeBegin = 0,
+                              uint64_t scopeEnd = 0) {
+    if (instruction.hasRelativeTarget()) {
+        uint64_t labelAddr = instruction.branchTarget();
+        SymbolIndex::Match symbol = addr2symbol.find(labelAddr);
+        if (!symbol && labelAddr >= scopeBegin && labelAddr < scopeEnd) {
+            symbol = addr2symbol.findPreceding(labelAddr);
+            if (labelAddr - symbol.offset < scopeBegin) {
+                symbol = SymbolIndex::Match{std::string_view(), 0};
+            }
+        }
+        out += to_string(instruction.mnemonic);
+        out += ' ';
+        appendHex(out, labelAddr);
+        if (symbol) {
+            out += " <";
+            out += symbol.name;
+            if (symbol.offset != 0) {
+                out += "+0x";
+                appendHex(out, symbol.offset);
+            }
+            out += '>';
+        }
+        out += " ; relative offset = ";
+        out += std::to_string(instruction.relativeOffset());
+        return;
+    }
+
+    std::string prefixStr = formatInstructionPrefix(instruction);
+    if (!prefixStr.empty()) {
+        out += prefixStr;
+        out += ' ';
+    }
+    out += to_string(instruction.mnemonic);
+    out += ' ';
+    for (int i = 0; i < instruction.numOperands; i++) {
+        out += ' ';
+        out += formatOperand(instruction, i);
+    }
+}
+
+/**
+ * @brief Converts a decoded instruction into text.
+ * @param instruction The decoded instruction.
+ * @param addr2symbol The symbols, used to label the targets of jumps and
+ * calls.
+ * @param scopeBegin The start of the range whose targets are labelled by
+ * the nearest preceding symbol (see appendInstruction).
+ * @param scopeEnd The end of the range (exclusive).
+ * @return The instruction text.
+ */
+inline std::string formatInstruction(const DecodedInstruction& instruction,
+                                     const SymbolIndex& addr2symbol,
+                                     uint64_t scopeBegin = 0,
+                                     uint64_t scopeEnd = 0) {
+    std::string text;
+    appendInstruction(text, instruction, addr2symbol, scopeBegin, scopeEnd);
+    return text;
+}
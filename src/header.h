@@ -41,6 +41,22 @@ typedef struct {
 } ELF64_SYM;
 
 
+// e_type of relocatable objects
+const uint16_t ELF_ET_REL = 1;
+// st_info type of functions
+const unsigned char ELF_STT_FUNC = 2;
+// st_shndx of undefined symbols, and the first reserved index (e.g. SHN_ABS)
+const uint16_t ELF_SHN_UNDEF = 0;
+const uint16_t ELF_SHN_LORESERVE = 0xff00;
+// e_shstrndx when the index is kept in sh_link of section 0
+const uint16_t ELF_SHN_XINDEX = 0xffff;
+// sh_type of sections without bytes in the file (e.g. .bss)
+const uint32_t ELF_SHT_NOBITS = 8;
+
+inline unsigned char elfSymType(const ELF64_SYM& sym) {
+    return sym.st_info & 0xf;
+}
+
 typedef struct
 {
   uint64_t	r_offset;		/* Address */
@@ -0,0 +1,120 @@
+/**
+ * @file
+ * @brief Defines the structured representation of a decoded instruction.
+ */
+
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+#include "constants.h"
+#include "error.h"
+#include "table.h"
+
+/**
+ * @brief Register number used when an operand has no register.
+ */
+constexpr int8_t NO_REG = -1;
+
+/**
+ * @brief Register number of rip for rip-relative addressing.
+ */
+constexpr int8_t RIP_REG = 16;
+
+/**
+ * @struct DecodedOperand
+ * @brief Represents an operand of a decoded instruction.
+ */
+struct DecodedOperand {
+    Operand kind; /**< The type of the operand */
+    int8_t reg;   /**< The register number (with the REX extension) of a
+                     register operand, the stack slot of st(i), or NO_REG */
+};
+
+/**
+ * @struct DecodedInstruction
+ * @brief Represents a decoded instruction without any text. Use
+ * formatInstruction in formatter.h to get the text.
+ */
+struct DecodedInstruction {
+    uint64_t startAddr; /**< The starting address of the instruction */
+    uint8_t length;     /**< The length of the instruction */
+    Mnemonic mnemonic;  /**< The mnemonic of the instruction */
+    Prefix prefix;      /**< The prefix used to look up the opcode */
+    OpEnc opEnc;        /**< The operand encoding */
+    int opcode;         /**< The one-byte or two-byte opcode */
+
+    DecodeStatus status; /**< DecodeStatus::OK, or why decoding failed */
+
+    uint16_t legacyPrefixes;   /**< Bitmask of PrefixBit */
+    uint8_t instructionPrefix; /**< 0xF0, 0xF2, 0xF3, 0x3E or 0 */
+    uint8_t segmentPrefix;     /**< 0x64 (fs), 0x65 (gs) or 0 */
+    uint8_t rex;               /**< The REX prefix byte or 0 */
+
+    bool hasModrm;  /**< Whether the instruction has the ModRM byte */
+    bool hasSib;    /**< Whether the instruction has the SIB byte */
+    uint8_t modrm;  /**< The ModRM byte */
+    uint8_t sib;    /**< The SIB byte */
+    int8_t base;    /**< The base register of the memory operand, RIP_REG
+                       or NO_REG */
+    int8_t index;   /**< The index register of the memory operand or NO_REG */
+    uint8_t scale;  /**< The scale of the index register */
+    uint8_t dispSize; /**< The size of the displacement (0, 1 or 4) */
+    int32_t disp;     /**< The sign-extended displacement */
+    uint8_t immSize;  /**< The size of the immediate (0, 1, 2, 4 or 8) */
+    uint64_t imm;     /**< The immediate (not sign-extended) */
+
+    uint8_t numOperands;                    /**< The number of operands */
+    DecodedOperand operands[MAX_OPERANDS]; /**< The operands */
+
+    /**
+     * @brief Checks whether this is a relative jump, call or loop.
+     * @return True if the instruction has a relative target.
+     */
+    bool hasRelativeTarget() const {
+        return isControlFlowInstruction(mnemonic) && numOperands == 1 &&
+               isIMM(operands[0].kind);
+    }
+
+    /**
+     * @brief Gets the sign-extended immediate.
+     * @return The sign-extended immediate.
+     */
+    int64_t signedImm() const {
+        switch (immSize) {
+            case 1:
+                return static_cast<int8_t>(imm);
+            case 2:
+                return static_cast<int16_t>(imm);
+            case 4:
+                return static_cast<int32_t>(imm);
+            default:
+                return static_cast<int64_t>(imm);
+        }
+    }
+
+    /**
+     * @brief Gets the offset from the next instruction to the target of a
+     * relative jump, call or loop.
+     * @return The offset, or 0 if there is no relative target.
+     */
+    int64_t relativeOffset() const {
+        return hasRelativeTarget() ? signedImm() : 0;
+    }
+
+    /**
+     * @brief Gets the address of the next instruction.
+     * @return The address of the next instruction.
+     */
+    uint64_t nextAddr() const { return startAddr + length; }
+
+    /**
+     * @brief Gets the target of a relative jump, call or loop.
+     * @return The target address, or nextAddr() if there is no relative
+     * target.
+     */
+    uint64_t branchTarget() const { return nextAddr() + relativeOffset(); }
+};
+
+static_assert(std::is_trivially_copyable<DecodedInstruction>::value,
+              "DecodedInstruction must be trivially copyable");
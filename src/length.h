@@ -0,0 +1,243 @@
+/**
+ * @file
+ * @brief Defines a table-driven decoder that computes only the length and
+ * the control-flow class of an instruction.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bytes.h"
+#include "constants.h"
+#include "span.h"
+#include "table.h"
+
+/**
+ * @brief The control-flow class of an instruction.
+ */
+enum class FlowClass : uint8_t {
+    FALLTHROUGH, /**< Execution continues at the next instruction */
+    JCC,         /**< Conditional branch (jcc, loop, jecxz) */
+    JMP,         /**< Unconditional jump */
+    CALL,        /**< Call */
+    RET,         /**< Return */
+    INVALID,     /**< The bytes cannot be decoded */
+};
+
+/**
+ * @struct InstructionLength
+ * @brief The result of decodeLength.
+ */
+struct InstructionLength {
+    uint8_t length; /**< The length of the instruction, or 0 if invalid */
+    FlowClass flow; /**< The control-flow class of the instruction */
+};
+
+/**
+ * @brief Gets the control-flow class of a mnemonic.
+ * @param mnemonic The mnemonic.
+ * @return The control-flow class.
+ */
+constexpr FlowClass flowClassOf(Mnemonic mnemonic) {
+    switch (mnemonic) {
+        case Mnemonic::JO:
+        case Mnemonic::JNO:
+        case Mnemonic::JNAE:
+        case Mnemonic::JNB:
+        case Mnemonic::JZ:
+        case Mnemonic::JNZ:
+        case Mnemonic::JNA:
+        case Mnemonic::JNBE:
+        case Mnemonic::JS:
+        case Mnemonic::JNS:
+        case Mnemonic::JP:
+        case Mnemonic::JPO:
+        case Mnemonic::JNGE:
+        case Mnemonic::JNL:
+        case Mnemonic::JNG:
+        case Mnemonic::JNLE:
+        case Mnemonic::LOOP:
+        case Mnemonic::LOOPE:
+        case Mnemonic::LOOPNE:
+        case Mnemonic::JECXZ:
+            return FlowClass::JCC;
+        case Mnemonic::JMP:
+            return FlowClass::JMP;
+        case Mnemonic::CALL:
+            return FlowClass::CALL;
+        case Mnemonic::RET:
+            return FlowClass::RET;
+        case Mnemonic::INVALID:
+            return FlowClass::INVALID;
+        default:
+            return FlowClass::FALLTHROUGH;
+    }
+}
+
+/**
+ * @struct LengthCell
+ * @brief What the length decoder needs to know about (prefix, opcode, reg).
+ */
+struct LengthCell {
+    bool hasModrm;  /**< Whether the ModRM byte follows the opcode */
+    uint8_t immSize; /**< The total size of the immediates in bytes */
+    FlowClass flow;  /**< FlowClass::INVALID if State::step would fail */
+};
+
+/**
+ * @struct LengthTable
+ * @brief Dense (prefix x opcode map x opcode byte x reg) table derived from
+ * OP_TABLE at compile time, so that decodeLength never touches mnemonics or
+ * operands.
+ */
+struct LengthTable {
+    LengthCell cells[NUM_PREFIXES][NUM_OPCODE_MAPS][256][NUM_REGS];
+
+    constexpr LengthTable() : cells{} {
+        for (int p = 0; p < NUM_PREFIXES; p++) {
+            for (int map = 0; map < NUM_OPCODE_MAPS; map++) {
+                for (int byte = 0; byte < 256; byte++) {
+                    const OpcodeSlot& slot = OP_TABLE.slots[p][map][byte];
+                    for (int reg = 0; reg < NUM_REGS; reg++) {
+                        cells[p][map][byte][reg] = makeCell(slot, reg);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Looks up the cell of the given prefix, opcode and reg.
+     * @param prefix The prefix.
+     * @param opcode The one-byte or two-byte opcode.
+     * @param reg The reg field of the ModRM byte.
+     * @return The cell.
+     */
+    constexpr const LengthCell& at(Prefix prefix, int opcode, int reg) const {
+        return cells[static_cast<int>(prefix)][twoByteOpcodeMap(opcode >> 8)]
+                    [opcode & 0xFF][reg];
+    }
+
+   private:
+    static constexpr LengthCell makeCell(const OpcodeSlot& slot, int reg) {
+        LengthCell cell = {false, 0, FlowClass::INVALID};
+        if (!slot.present || slot.regs[reg].operandIdx < 0) {
+            return cell;
+        }
+        const OperandEntry& entry = OPERAND_ENTRIES[slot.regs[reg].operandIdx];
+        cell.hasModrm = hasModrm(entry.opEnc);
+        for (int i = 0; i < entry.numOperands; i++) {
+            Operand operand = entry.operands[i];
+            if (operand == Operand::imm64) {
+                cell.immSize += 8;
+            } else if (operand == Operand::imm32) {
+                cell.immSize += 4;
+            } else if (operand == Operand::imm16) {
+                cell.immSize += 2;
+            } else if (operand == Operand::imm8) {
+                cell.immSize += 1;
+            } else if (!cell.hasModrm &&
+                       (isRM(operand) || isREG(operand) || isM(operand)) &&
+                       (entry.remOp[0] < '0' || entry.remOp[0] > '7')) {
+                // State::parseOperands rejects this entry
+                return cell;
+            }
+        }
+        cell.flow = flowClassOf(slot.regs[reg].mnemonic);
+        return cell;
+    }
+};
+
+inline constexpr LengthTable LENGTH_TABLE{};
+
+/**
+ * @brief Computes the length and the control-flow class of the instruction
+ * at the beginning of [begin, end) without decoding its operands. The result
+ * agrees with the length of State::step, and is FlowClass::INVALID wherever
+ * State::step fails.
+ * @param begin The first byte of the instruction.
+ * @param end The end of the object code.
+ * @return The length and the control-flow class.
+ */
+inline InstructionLength decodeLength(const uint8_t* begin,
+                                      const uint8_t* end) {
+    constexpr InstructionLength invalid = {0, FlowClass::INVALID};
+    const uint8_t* cur = begin;
+
+    // endbr64 / endbr32
+    if (end - cur > 3 && cur[0] == 0xF3 && cur[1] == 0x0F && cur[2] == 0x1E &&
+        (cur[3] == 0xFA || cur[3] == 0xFB)) {
+        return {4, FlowClass::FALLTHROUGH};
+    }
+
+    // legacy prefixes in any order, then REX
+    Prefix prefix = Prefix::NONE;
+    uint16_t bit;
+    while (cur < end && cur - begin < MAX_INSTRUCTION_LENGTH - 1 &&
+           (bit = BYTE_CLASS[*cur] & LEGACY_PREFIX_MASK) != 0) {
+        if (bit == PREFIX_OPSIZE) {
+            prefix = Prefix::P66;
+        }
+        cur++;
+    }
+    if (cur < end && (BYTE_CLASS[*cur] & PREFIX_REX)) {
+        prefix = (*cur & 0x8) ? Prefix::REXW : Prefix::REX;
+        cur++;
+    }
+
+    // opcode
+    if (cur >= end) {
+        return invalid;
+    }
+    int opcode = *cur++;
+    if (cur < end && twoByteOpcodeMap(opcode) != ONE_BYTE_MAP &&
+        OP_TABLE.at(prefix, (opcode << 8) + *cur).present) {
+        opcode = (opcode << 8) + *cur++;
+    }
+
+    int reg = cur < end ? (*cur >> 3) & 0x7 : 0;
+    const LengthCell& cell = LENGTH_TABLE.at(prefix, opcode, reg);
+    if (cell.flow == FlowClass::INVALID) {
+        return invalid;
+    }
+
+    // ModRM, SIB and displacement
+    size_t rest = cell.immSize;
+    if (cell.hasModrm) {
+        if (cur >= end) {
+            return invalid;
+        }
+        const ModRM& modrm = MODRM_TABLE[*cur++];
+        SIB sib = {};
+        if (modrm.hasSib) {
+            if (cur >= end) {
+                return invalid;
+            }
+            sib = SIB_TABLE[*cur++];
+        }
+        rest += dispSizeOf(modrm, sib);
+    }
+
+    if (static_cast<size_t>(end - cur) < rest ||
+        cur + rest - begin > MAX_INSTRUCTION_LENGTH) {
+        return invalid;
+    }
+    return {static_cast<uint8_t>(cur + rest - begin), cell.flow};
+}
+
+/**
+ * @brief Computes the length and the control-flow class of the instruction
+ * at the given address.
+ * @param objectSource The object code.
+ * @param startAddr The starting address of the instruction.
+ * @return The length and the control-flow class.
+ */
+inline InstructionLength decodeLength(ByteSpan objectSource,
+                                      uint64_t startAddr) {
+    if (startAddr >= objectSource.size()) {
+        return {0, FlowClass::INVALID};
+    }
+    return decodeLength(objectSource.begin() + startAddr, objectSource.end());
+}
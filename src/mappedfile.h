@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @brief Defines a read-only memory mapping of a file.
+ */
+
+#pragma once
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "span.h"
+
+/**
+ * @struct MappedFile
+ * @brief Maps a whole file read-only, followed by at least one page of zero
+ * bytes, so that decoders may read a little past the end of the file.
+ */
+struct MappedFile {
+    /**
+     * @brief Maps a file.
+     * @param path The path of the file.
+     * @throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open object file: " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat object file: " + path);
+        }
+        fileSize = st.st_size;
+
+        // reserve the file and one more page of zeros, then map the file
+        // over the front of the reservation
+        size_t pageSize = ::sysconf(_SC_PAGESIZE);
+        mapSize = (fileSize + pageSize - 1) / pageSize * pageSize + pageSize;
+        void *base = ::mmap(nullptr, mapSize, PROT_READ,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("Failed to map object file: " + path);
+        }
+        if (fileSize > 0 &&
+            ::mmap(base, fileSize, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd,
+                   0) == MAP_FAILED) {
+            ::munmap(base, mapSize);
+            ::close(fd);
+            throw std::runtime_error("Failed to map object file: " + path);
+        }
+        ::close(fd);
+        addr = static_cast<const uint8_t *>(base);
+        if (fileSize > 0) {
+            ::madvise(base, fileSize, MADV_SEQUENTIAL);
+        }
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile() {
+        if (addr != nullptr) {
+            ::munmap(const_cast<uint8_t *>(addr), mapSize);
+        }
+    }
+
+    /**
+     * @brief Gets the size of the file.
+     * @return The size in bytes.
+     */
+    uint64_t size() const { return fileSize; }
+
+    /**
+     * @brief Views the file and the given number of zero bytes after it.
+     * @param padding The number of zero bytes (at most one page).
+     * @return The view.
+     */
+    ByteSpan bytes(size_t padding = 0) const {
+        return ByteSpan(addr, fileSize + padding);
+    }
+
+    /**
+     * @brief Asks the kernel to read a range of the file ahead, e.g. a
+     * section that is about to be decoded.
+     * @param offset The offset of the range.
+     * @param length The length of the range.
+     */
+    void willNeed(uint64_t offset, uint64_t length) const {
+        if (offset >= fileSize || length == 0) {
+            return;
+        }
+        size_t pageSize = ::sysconf(_SC_PAGESIZE);
+        uint64_t begin = offset / pageSize * pageSize;
+        uint64_t end = std::min<uint64_t>(offset + length, fileSize);
+        ::madvise(const_cast<uint8_t *>(addr) + begin, end - begin,
+                  MADV_WILLNEED);
+    }
+
+   private:
+    const uint8_t *addr = nullptr; /**< The start of the mapping */
+    uint64_t fileSize = 0;         /**< The size of the file */
+    size_t mapSize = 0;            /**< The size of the mapping */
+};
@@ -0,0 +1,173 @@
+/**
+ * @file
+ * @brief Defines a buffered output sink that writes with write(2).
+ */
+
+#pragma once
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+/**
+ * @struct HexTable
+ * @brief The lowercase hex digits of all 256 bytes, without leading zeros.
+ */
+struct HexTable {
+    char digits[256][2]; /**< The digits of each byte */
+    uint8_t length[256]; /**< The number of digits of each byte (1 or 2) */
+
+    constexpr HexTable() : digits{}, length{} {
+        constexpr char hex[] = "0123456789abcdef";
+        for (int byte = 0; byte < 256; byte++) {
+            if (byte < 16) {
+                digits[byte][0] = hex[byte];
+                length[byte] = 1;
+            } else {
+                digits[byte][0] = hex[byte >> 4];
+                digits[byte][1] = hex[byte & 0xF];
+                length[byte] = 2;
+            }
+        }
+    }
+};
+
+inline constexpr HexTable HEX_TABLE{};
+
+/**
+ * @struct OutputSink
+ * @brief Formats text into a large buffer and writes the buffer to a file
+ * descriptor with write(2) when it fills up, without going through
+ * iostream. If a write fails, the rest of the output is dropped and the
+ * failure is kept for error().
+ */
+struct OutputSink {
+    /**
+     * @brief The size of the buffer in bytes.
+     */
+    static constexpr size_t BUFFER_SIZE = 1 << 16;
+
+    /**
+     * @brief Constructor for OutputSink.
+     * @param fd The file descriptor to write to.
+     */
+    explicit OutputSink(int fd = STDOUT_FILENO) : fd(fd) {
+        // keep the order of anything already written through std::cout
+        std::cout.flush();
+    }
+
+    OutputSink(const OutputSink &) = delete;
+    OutputSink &operator=(const OutputSink &) = delete;
+
+    ~OutputSink() { flush(); }
+
+    /**
+     * @brief Appends a string.
+     * @param str The string.
+     * @return This sink.
+     */
+    OutputSink &write(std::string_view str) {
+        if (str.size() > BUFFER_SIZE - len) {
+            flush();
+            if (str.size() > BUFFER_SIZE) {
+                writeAll(str.data(), str.size());
+                return *this;
+            }
+        }
+        std::memcpy(buf + len, str.data(), str.size());
+        len += str.size();
+        return *this;
+    }
+
+    /**
+     * @brief Appends a character.
+     * @param c The character.
+     * @return This sink.
+     */
+    OutputSink &put(char c) {
+        if (len == BUFFER_SIZE) {
+            flush();
+        }
+        buf[len++] = c;
+        return *this;
+    }
+
+    /**
+     * @brief Appends c n times.
+     * @param c The character.
+     * @param n The number of characters.
+     * @return This sink.
+     */
+    OutputSink &fill(char c, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            put(c);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Appends the lowercase hex digits of a byte without leading
+     * zeros, e.g. "0" or "1f".
+     * @param byte The byte.
+     * @return This sink.
+     */
+    OutputSink &hexByte(uint8_t byte) {
+        return write(std::string_view(HEX_TABLE.digits[byte],
+                                      HEX_TABLE.length[byte]));
+    }
+
+    /**
+     * @brief Appends the lowercase hex digits of a number without leading
+     * zeros, e.g. "401a".
+     * @param value The number.
+     * @return This sink.
+     */
+    OutputSink &hex(uint64_t value) {
+        char digits[16];
+        char *end = digits + sizeof(digits);
+        char *cur = end;
+        do {
+            *--cur = "0123456789abcdef"[value & 0xF];
+            value >>= 4;
+        } while (value != 0);
+        return write(std::string_view(cur, end - cur));
+    }
+
+    /**
+     * @brief Writes the buffered bytes to the file descriptor.
+     */
+    void flush() {
+        writeAll(buf, len);
+        len = 0;
+    }
+
+    /**
+     * @brief Gets the error of the first failed write, e.g. EPIPE or ENOSPC.
+     * @return The errno of the failure, or 0 if every write succeeded.
+     */
+    int error() const { return writeError; }
+
+   private:
+    int fd;                 /**< The file descriptor */
+    int writeError = 0;     /**< The errno of the first failed write */
+    size_t len = 0;         /**< The number of buffered bytes */
+    char buf[BUFFER_SIZE];  /**< The buffer */
+
+    void writeAll(const char *data, size_t size) {
+        while (size > 0 && writeError == 0) {
+            ssize_t n = ::write(fd, data, size);
+            if (n < 0) {
+                if (errno != EINTR) {
+                    writeError = errno;
+                }
+                continue;
+            }
+            data += n;
+            size -= n;
+        }
+    }
+};
@@ -0,0 +1,57 @@
+/**
+ * @file
+ * @brief Defines a non-owning view of a byte array.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct ByteSpan
+ * @brief A read-only view of contiguous bytes, like std::span<const
+ * uint8_t>. The viewed bytes must outlive the span.
+ */
+struct ByteSpan {
+    ByteSpan() : ptr(nullptr), len(0) {}
+
+    /**
+     * @brief Constructor for ByteSpan.
+     * @param ptr The first byte.
+     * @param len The number of bytes.
+     */
+    ByteSpan(const uint8_t* ptr, size_t len) : ptr(ptr), len(len) {}
+
+    /**
+     * @brief Views the contents of a vector.
+     * @param bytes The vector.
+     */
+    ByteSpan(const std::vector<unsigned char>& bytes)
+        : ptr(bytes.data()), len(bytes.size()) {}
+
+    const uint8_t* data() const { return ptr; }
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    const uint8_t* begin() const { return ptr; }
+    const uint8_t* end() const { return ptr + len; }
+    const uint8_t& operator[](size_t idx) const { return ptr[idx]; }
+
+    /**
+     * @brief Views a part of the bytes, clamped to the end of this span.
+     * @param offset The index of the first byte.
+     * @param count The number of bytes.
+     * @return The view.
+     */
+    ByteSpan subspan(size_t offset, size_t count) const {
+        if (offset > len) {
+            return ByteSpan(ptr + len, 0);
+        }
+        return ByteSpan(ptr + offset,
+                        count < len - offset ? count : len - offset);
+    }
+
+   private:
+    const uint8_t* ptr; /**< The first byte */
+    size_t len;         /**< The number of bytes */
+};
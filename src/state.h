@@ -4,102 +4,75 @@
  */
 
 #pragma once
-#include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <iomanip>
-#include <iostream>
-#include <sstream>
-#include <string>
-#include <unordered_map>
-#include <utility>
+#include <type_traits>
 #include <vector>
 
 #include "bytes.h"
 #include "constants.h"
 #include "error.h"
+#include "instruction.h"
+#include "span.h"
 #include "table.h"
 
 /**
- * @brief Decodes the given hexadecimal offset string into a signed long long
- * integer.
- * @param val The hexadecimal offset string.
- * @return The decoded offset.
+ * @brief The number of readable bytes the fast path of State needs after the
+ * end of the object code. Loaders append this many zero bytes.
  */
-inline long long decodeOffset(const std::string& val) {
-    long long offset;
-
-    offset = stoul(val, nullptr, 16);
-
-    if (val.size() <= 2 + 2) {
-        if (offset > 0x7F) {
-            offset -= 0x100;
-        }
-    } else if (val.size() <= 4 + 2) {
-        if (offset > 0x7FFF) {
-            offset -= 0x10000;
-        }
-    } else if (val.size() <= 8 + 2) {
-        if (offset > 0x7FFFFFFF) {
-            offset -= 0x100000000;
-        }
-    }
-
-    return offset;
-}
+constexpr uint64_t DECODE_PADDING = 16;
 
 /**
- * @struct DisassembledResult
- * @brief Represents the result of disassembling an instruction.
+ * @brief An upper bound of the bytes State reads for one instruction: 14
+ * legacy prefixes, REX, two opcode bytes, ModRM, SIB, disp32 and imm64.
  */
-typedef struct {
-    uint64_t startAddr; /**< The starting address of the instruction */
-    uint64_t disassembledInstructionSize; /**< The length of the instruction */
-    Mnemonic mnemonic; /**< The mnemonic of the instruction */
-    std::string
-        disassembledInstructionStr; /**< The disassembled instruction string */
-    long long nextOffset;           /**< The offset to the next instruction */
-} DisassembledResult;
+constexpr uint64_t MAX_DECODE_READ = 32;
 
 /**
  * @struct State
  * @brief Represents the state of the disassembler.
  */
 struct State {
-    const std::vector<unsigned char>& objectSource;
-    const std::unordered_map<uint64_t, std::string>& addr2symbol;
+    const unsigned char* objectSource;
+    uint64_t objectSize;
+    bool padded;
 
     bool hasInstructionPrefix, hasSegmentOverridePrefix, hasREX, hasSIB,
         hasDisp8, hasDisp32;
     uint64_t curAddr, disassembledInstructionSize, prefixOffset;
-    int instructionPrefixByte, opcodeByte, modrmByte, sibByte;
-
-    std::string prefixInstructionStr;
-    std::string prefixSegmentOverrideStr;
+    int instructionPrefixByte, segmentOverridePrefixByte, rexByte, opcodeByte,
+        modrmByte, sibByte;
+    uint16_t legacyPrefixes;
 
     Mnemonic mnemonic;
     Prefix prefix;
-    REX rex;
     ModRM modrm;
     SIB sib;
 
     OpEnc opEnc;
-    std::vector<std::string> remOps;
-    std::vector<Operand> operands;
+    const char* remOp;
+    const Operand* operands;
+    int numOperands;
 
-    std::string disp8, disp32;
+    int32_t disp;
+    uint64_t imm;
+    int immSize;
+    DecodedOperand decodedOperands[MAX_OPERANDS];
 
-    std::vector<std::string> disassembledInstruction;
-    std::vector<std::string> disassembledOperands;
+    DecodeStatus status;
 
     /**
      * @brief Constructor for State.
-     * @param objectSource The object code to disassemble.
-     * @param addr2symbol Mapping of addresses to symbols.
+     * @param begin The first byte of the object code to disassemble.
+     * @param end The end of the object code. Instructions are clamped to it.
+     * @param padded Whether at least DECODE_PADDING bytes after end are
+     * readable, which enables the fast path without bounds checks.
      */
-    State(const std::vector<unsigned char>& objectSource,
-          const std::unordered_map<uint64_t, std::string>& addr2symbol)
-        : objectSource(objectSource),
-          addr2symbol(addr2symbol),
+    State(const unsigned char* begin, const unsigned char* end,
+          bool padded = false)
+        : objectSource(begin),
+          objectSize(end - begin),
+          padded(padded),
           hasInstructionPrefix(false),
           hasSegmentOverridePrefix(false),
           hasREX(false),
@@ -109,20 +82,55 @@ struct State {
           curAddr(0),
           disassembledInstructionSize(0),
           prefixOffset(0),
-          prefix(Prefix::NONE) {}
+          instructionPrefixByte(0),
+          segmentOverridePrefixByte(0),
+          rexByte(0),
+          opcodeByte(0),
+          modrmByte(-1),
+          sibByte(-1),
+          legacyPrefixes(0),
+          prefix(Prefix::NONE),
+          modrm{},
+          sib{},
+          remOp(""),
+          operands(nullptr),
+          numOperands(0),
+          disp(0),
+          imm(0),
+          immSize(0),
+          status(DecodeStatus::OK) {}
+
+    /**
+     * @brief Constructor for State.
+     * @param objectSource The object code to disassemble.
+     */
+    State(ByteSpan objectSource)
+        : State(objectSource.begin(), objectSource.end()) {}
+
+    /**
+     * @brief Checks whether the next bytes can be read. Without the bounds
+     * checks, this is always true and the caller clamps the length instead.
+     * @tparam checked Whether to check the bounds.
+     * @param size The number of bytes.
+     * @return True if the bytes can be read.
+     */
+    template <bool checked>
+    bool canRead(uint64_t size) const {
+        return !checked || curAddr + size <= objectSize;
+    }
 
     /**
      * @brief Parses the endbr instruction.
      * @return True if an endbr instruction is parsed, false otherwise.
      */
+    template <bool checked>
     bool parseEndBr() {
-        if (curAddr + 3 < objectSource.size()) {
+        if (canRead<checked>(4)) {
             if (objectSource[curAddr] == 0xF3 &&
                 objectSource[curAddr + 1] == 0x0F &&
                 objectSource[curAddr + 2] == 0x1E &&
                 objectSource[curAddr + 3] == 0xFA) {
-                disassembledInstruction.emplace_back(
-                    to_string(Mnemonic::ENDBR64));
+                mnemonic = Mnemonic::ENDBR64;
                 opEnc = OpEnc::NP;
                 disassembledInstructionSize += 4;
                 curAddr += 4;
@@ -131,8 +139,7 @@ struct State {
                        objectSource[curAddr + 1] == 0x0F &&
                        objectSource[curAddr + 2] == 0x1E &&
                        objectSource[curAddr + 3] == 0xFB) {
-                disassembledInstruction.emplace_back(
-                    to_string(Mnemonic::ENDBR32));
+                mnemonic = Mnemonic::ENDBR32;
                 opEnc = OpEnc::NP;
                 disassembledInstructionSize += 4;
                 curAddr += 4;
@@ -145,39 +152,33 @@ struct State {
     }
 
     /**
-     * @brief Parses the operand-size prefixe.
-     */
-    void parseOperandSizePrefix() {
-        if (objectSource[curAddr] == 0x66) {
-            prefix = Prefix::P66;
-            disassembledInstructionSize += 1;
-            curAddr += 1;
-        }
-    }
-
-    void parseSegmentOverridePrefix() {
-        if (objectSource[curAddr] == 0x64) {
-            hasSegmentOverridePrefix = true;
-            prefixSegmentOverrideStr = "fs";
-            disassembledInstructionSize += 1;
-            curAddr += 1;
-        } else if (objectSource[curAddr] == 0x65) {
-            hasSegmentOverridePrefix = true;
-            prefixSegmentOverrideStr = "gs";
-            disassembledInstructionSize += 1;
-            curAddr += 1;
-        }
-    }
-
-    /**
-     * @brief Parses instruction prefixes.
+     * @brief Parses the legacy prefixes, in any number and order, into the
+     * prefix bitmask. When a group repeats, the last byte wins.
+     * @param startAddr The starting address of the instruction.
      */
-    void parsePrefixInstructions() {
-        if (INSTRUCTION_PREFIX_SET.find(objectSource[curAddr]) !=
-            INSTRUCTION_PREFIX_SET.end()) {
-            hasInstructionPrefix = true;
-            instructionPrefixByte = objectSource[curAddr];
-            prefixOffset = 1;
+    template <bool checked>
+    void parseLegacyPrefixes(uint64_t startAddr) {
+        // leave room for the opcode within the 15-byte limit
+        while (canRead<checked>(1) &&
+               curAddr - startAddr < MAX_INSTRUCTION_LENGTH - 1) {
+            unsigned char byte = objectSource[curAddr];
+            uint16_t bit = BYTE_CLASS[byte] & LEGACY_PREFIX_MASK;
+            if (bit == 0) {
+                break;
+            }
+            legacyPrefixes |= bit;
+
+            if (bit & (PREFIX_LOCK | PREFIX_REPNE | PREFIX_REP | PREFIX_DS)) {
+                // 3E is printed as notrack
+                hasInstructionPrefix = true;
+                instructionPrefixByte = byte;
+            } else if (bit & (PREFIX_FS | PREFIX_GS)) {
+                hasSegmentOverridePrefix = true;
+                segmentOverridePrefixByte = byte;
+            } else if (bit & PREFIX_OPSIZE) {
+                prefix = Prefix::P66;
+            }
+            prefixOffset += 1;
             disassembledInstructionSize += 1;
             curAddr += 1;
         }
@@ -186,15 +187,17 @@ struct State {
     /**
      * @brief Parses the REX prefix.
      */
+    template <bool checked>
     void parseREX() {
         // The format of REX prefix is 0100|W|R|X|B
-        if ((objectSource[curAddr] >> 4) == 4) {
+        if (canRead<checked>(1) &&
+            (BYTE_CLASS[objectSource[curAddr]] & PREFIX_REX)) {
             hasREX = true;
-            rex = REX(objectSource[curAddr]);
+            rexByte = objectSource[curAddr];
             disassembledInstructionSize += 1;
             curAddr += 1;
 
-            if (rex.rexW) {
+            if (rexW(rexByte)) {
                 prefix = Prefix::REXW;
             } else {
                 prefix = Prefix::REX;
@@ -204,324 +207,337 @@ struct State {
 
     /**
      * @brief Parses the opcode byte.
+     * @return False if the opcode is unknown (see status).
      */
-    void parseOpcode() {
+    template <bool checked>
+    bool parseOpcode() {
+        if (!canRead<checked>(1)) {
+            status = DecodeStatus::TRUNCATED;
+            return false;
+        }
+
         // eat opcode
         opcodeByte = objectSource[curAddr];
         disassembledInstructionSize += 1;
         curAddr += 1;
 
-        int potentialOpCodeByte = (opcodeByte << 8) + objectSource[curAddr];
-
-        if ((TWO_BYTES_OPCODE_PREFIX.find(opcodeByte) !=
-             TWO_BYTES_OPCODE_PREFIX.end()) &&
-            ((OP_LOOKUP.find(std::make_pair(prefix, potentialOpCodeByte)) !=
-              OP_LOOKUP.end()) ||
-             (prefix == Prefix::REXW &&
-              OP_LOOKUP.find(std::make_pair(
-                  Prefix::REX, potentialOpCodeByte)) != OP_LOOKUP.end()) ||
-             (prefix == Prefix::REX &&
-              OP_LOOKUP.find(std::make_pair(
-                  Prefix::NONE, potentialOpCodeByte)) != OP_LOOKUP.end()))) {
-            opcodeByte = potentialOpCodeByte;
+        if (canRead<checked>(1) &&
+            twoByteOpcodeMap(opcodeByte) != ONE_BYTE_MAP &&
+            OP_TABLE.at(prefix, (opcodeByte << 8) + objectSource[curAddr])
+                .present) {
+            opcodeByte = (opcodeByte << 8) + objectSource[curAddr];
             disassembledInstructionSize += 1;
             curAddr += 1;
         }
 
         // (prefix, opcode) -> (reg, mnemonic)
-        std::unordered_map<int, Mnemonic> reg2mnem;
-        if (OP_LOOKUP.find(std::make_pair(prefix, opcodeByte)) !=
-            OP_LOOKUP.end()) {
-            reg2mnem = OP_LOOKUP.at(std::make_pair(prefix, opcodeByte));
-        } else if (prefix == Prefix::REXW &&
-                   OP_LOOKUP.find(std::make_pair(Prefix::REX, opcodeByte)) !=
-                       OP_LOOKUP.end()) {
-            reg2mnem = OP_LOOKUP.at(std::make_pair(Prefix::REX, opcodeByte));
-            prefix = Prefix::REX;
-        } else if (prefix == Prefix::REX &&
-                   OP_LOOKUP.find(std::make_pair(Prefix::NONE, opcodeByte)) !=
-                       OP_LOOKUP.end()) {
-            reg2mnem = OP_LOOKUP.at(std::make_pair(Prefix::NONE, opcodeByte));
-            prefix = Prefix::NONE;
-        } else {
-            std::stringstream ss;
-            ss << std::hex << opcodeByte;
-            throw OPCODE_LOOKUP_ERROR(
-                "Unknown combination of the prefix and the opcodeByte: (" +
-                to_string(prefix) + ", " + ss.str() + ")");
+        const OpcodeSlot& slot = OP_TABLE.at(prefix, opcodeByte);
+        if (!slot.present) {
+            status = DecodeStatus::UNKNOWN_OPCODE;
+            return false;
         }
+        prefix = slot.prefix;
 
         // We sometimes need reg of modrm to determine the opcode
         // e.g. 83 /4 -> AND
         //      83 /1 -> OR
-        if (curAddr < objectSource.size()) {
+        if (canRead<checked>(1)) {
             modrmByte = objectSource[curAddr];
         }
 
-        if (modrmByte >= 0) {
-            int reg = (modrmByte >> 3) & 0x7;
-            mnemonic = (reg2mnem.find(reg) != reg2mnem.end()) ? reg2mnem.at(reg)
-                                                              : reg2mnem.at(-1);
-        } else {
-            mnemonic = reg2mnem.at(-1);
+        const OpcodeCell& cell =
+            slot.regs[modrmByte >= 0 ? (modrmByte >> 3) & 0x7 : 0];
+        mnemonic = cell.mnemonic;
+        if (mnemonic == Mnemonic::INVALID) {
+            status = DecodeStatus::UNKNOWN_OPCODE;
+            return false;
         }
-
-        if (hasInstructionPrefix) {
-            if (instructionPrefixByte == 0xF0) {
-                disassembledInstruction.emplace_back("lock");
-            } else if (instructionPrefixByte == 0xF2) {
-                if (isControlFlowInstruction(mnemonic)) {
-                    disassembledInstruction.emplace_back("bnd");
-                } else {
-                    disassembledInstruction.emplace_back("repne");
-                }
-            } else if (instructionPrefixByte == 0xF3) {
-                disassembledInstruction.emplace_back("rep");
-            } else if (instructionPrefixByte == 0x3E) {
-                disassembledInstruction.emplace_back("notrack");
-            }
+        if (cell.operandIdx < 0) {
+            status = DecodeStatus::UNKNOWN_OPERAND;
+            return false;
         }
 
-        disassembledInstruction.emplace_back(to_string(mnemonic));
-
-        if (OPERAND_LOOKUP.find(std::make_tuple(
-                prefix, mnemonic, opcodeByte)) != OPERAND_LOOKUP.end()) {
-            std::tuple<OpEnc, std::vector<std::string>, std::vector<Operand>>
-                res = OPERAND_LOOKUP.at(
-                    std::make_tuple(prefix, mnemonic, opcodeByte));
-            opEnc = std::get<0>(res);
-            remOps = std::get<1>(res);
-            operands = std::get<2>(res);
-        } else {
-            std::stringstream ss;
-            ss << std::hex << opcodeByte;
-            throw OPERAND_LOOKUP_ERROR(
-                "Unknown combination of prefix, mnemonic and opcodeByte: (" +
-                to_string(prefix) + ", " + to_string(mnemonic) + ", " +
-                ss.str() + ")");
-        }
+        const OperandEntry& entry = OPERAND_ENTRIES[cell.operandIdx];
+        opEnc = entry.opEnc;
+        remOp = entry.remOp;
+        operands = entry.operands;
+        numOperands = entry.numOperands;
+        return true;
     }
 
     /**
      * @brief Parses the ModRM byte.
+     * @return False if there aren't any bytes left (see status).
      */
-    void parseModRM() {
+    bool parseModRM() {
         if (hasModrm(opEnc)) {
             if (modrmByte < 0) {
-                throw std::runtime_error(
-                    "Expected ModRM byte but there aren't any bytes left.");
+                status = DecodeStatus::TRUNCATED;
+                return false;
             }
             disassembledInstructionSize += 1;
             curAddr += 1;
-            modrm = ModRM(modrmByte, rex);
+            modrm = MODRM_TABLE[modrmByte];
         }
+        return true;
     }
 
     /**
      * @brief Parses the SIB byte.
+     * @return False if there aren't any bytes left (see status).
      */
-    void parseSIB() {
+    template <bool checked>
+    bool parseSIB() {
         if (hasModrm(opEnc) && modrm.hasSib) {
             // eat the sib (1 byte)
-            if (curAddr < objectSource.size()) {
+            if (canRead<checked>(1)) {
                 sibByte = objectSource[curAddr];
             }
             if (sibByte < 0) {
-                throw std::runtime_error(
-                    "Expected SIB byte but there aren't any bytes left.");
+                status = DecodeStatus::TRUNCATED;
+                return false;
             }
-            sib = SIB(sibByte, modrm.modByte, rex);
+            sib = SIB_TABLE[sibByte];
             disassembledInstructionSize += 1;
             curAddr += 1;
         }
+        return true;
     }
 
     /**
-     * @brief Parses the address offset.
+     * @brief Reads a little-endian integer from the object code.
+     * @param size The number of bytes to read.
+     * @param value The integer (not sign-extended).
+     * @return False if there aren't enough bytes left (see status).
      */
-    void parseAddressOffset() {
-        if ((hasModrm(opEnc) && modrm.hasDisp8) ||
-            (hasModrm(opEnc) && modrm.hasSib && sib.hasDisp8) ||
-            (hasModrm(opEnc) && modrm.hasSib && modrm.modByte == 1 &&
-             sib.baseByte == 5)) {
-            std::stringstream ss1;
-            ss1 << std::hex << (int)objectSource[curAddr];
-            disp8 = "0x" + ss1.str();
-
-            long long decoded_disp8 = decodeOffset(disp8);
-            if (decoded_disp8 < 0) {
-                std::stringstream ss2;
-                ss2 << std::hex << (-1 * decoded_disp8);
-                disp8 = " - 0x" + ss2.str();
-            } else {
-                disp8 = " + " + disp8;
-            }
+    template <bool checked>
+    bool readLittleEndian(int size, uint64_t& value) {
+        if (!canRead<checked>(size)) {
+            status = DecodeStatus::TRUNCATED;
+            return false;
+        }
+        value = 0;
+        for (int i = size - 1; i >= 0; i--) {
+            value = (value << 8) | objectSource[curAddr + i];
+        }
+        disassembledInstructionSize += size;
+        curAddr += size;
+        return true;
+    }
 
-            hasDisp8 = true;
-            disassembledInstructionSize += 1;
-            curAddr += 1;
+    /**
+     * @brief Parses the address offset.
+     * @return False if there aren't enough bytes left (see status).
+     */
+    template <bool checked>
+    bool parseAddressOffset() {
+        if (!hasModrm(opEnc)) {
+            return true;
         }
 
-        if ((hasModrm(opEnc) && modrm.hasDisp32) ||
-            (hasModrm(opEnc) && modrm.hasSib && sib.hasDisp32) ||
-            (hasModrm(opEnc) && modrm.hasSib &&
-             (modrm.modByte == 0 || modrm.modByte == 2) && sib.baseByte == 5)) {
-            std::vector<uint8_t> _disp32 =
-                std::vector<uint8_t>(objectSource.begin() + curAddr,
-                                     objectSource.begin() + curAddr + 4);
-            std::reverse(_disp32.begin(), _disp32.end());
-            std::stringstream ss;
-            ss << "0x";
-            for (unsigned char x : _disp32) {
-                ss << std::hex << std::setw(2) << std::setfill('0')
-                   << static_cast<int>(x);
+        uint64_t value;
+        int dispSize = dispSizeOf(modrm, sib);
+        if (dispSize == 1) {
+            if (!readLittleEndian<checked>(1, value)) {
+                return false;
             }
-            disp32 = ss.str();
-
-            long long decoded_disp32 = decodeOffset(disp32);
-            if (decoded_disp32 < 0) {
-                std::stringstream ss;
-                ss << std::hex << (-1 * decoded_disp32);
-                disp32 = " - 0x" + ss.str();
-            } else {
-                disp32 = " + " + disp32;
+            disp = static_cast<int8_t>(value);
+            hasDisp8 = true;
+        } else if (dispSize == 4) {
+            if (!readLittleEndian<checked>(4, value)) {
+                return false;
             }
-
+            disp = static_cast<int32_t>(value);
             hasDisp32 = true;
-            disassembledInstructionSize += 4;
-            curAddr += 4;
         }
+        return true;
     }
 
     /**
-     * @brief Executes a step in disassembling the instruction.
-     * @param startAddr The starting address of the instruction.
-     * @return The disassembled result.
+     * @brief Parses the registers and the immediate of the operands.
+     * @return False if the operands cannot be decoded (see status).
      */
-    DisassembledResult step(uint64_t startAddr) {
-        // ############### Initialize ##############################
-        curAddr = startAddr;
-
-        // the general format of the x86-64 operations
-        // |prefix|REX prefix|opcode|ModR/M|SIB|address offset|immediate|
-
-        if (!parseEndBr()) {
-            parsePrefixInstructions();
-            parseSegmentOverridePrefix();
-            parseOperandSizePrefix();
-            parseREX();
-            parseOpcode();
-            parseModRM();
-            parseSIB();
-            parseAddressOffset();
-        }
-
-        // ############### Process Operands ################
-        std::vector<uint8_t> imm;
-        for (Operand operand : operands) {
-            std::string decodedOperandStr;
-
-            if (isA_REG(operand) || operand == Operand::cl ||
-                operand == Operand::dx) {
-                decodedOperandStr = to_string(operand);
-            } else if (operand == Operand::sti) {
-                decodedOperandStr = "st(" + remOps[0] + ")";
+    template <bool checked>
+    bool parseOperands() {
+        for (int i = 0; i < numOperands; i++) {
+            Operand operand = operands[i];
+            int8_t reg = NO_REG;
+
+            if (operand == Operand::sti) {
+                reg = remOp[0] - '0';
             } else if (isRM(operand) || isREG(operand) || isM(operand)) {
                 if (hasModrm(opEnc)) {
                     if (isRM(operand) || isM(operand)) {
-                        decodedOperandStr =
-                            modrm.getAddrMode(operand, disp8, disp32);
+                        if (modrm.modByte == 3) {
+                            reg = modrm.rmByte | rexB(rexByte);
+                        }
                     } else {
-                        decodedOperandStr = modrm.getReg(operand);
+                        reg = modrm.regByte | rexR(rexByte);
                     }
                 } else {
-                    int regIdx = (hasREX && rex.rexB) ? std::stoi(remOps[0]) + 8
-                                                      : std::stoi(remOps[0]);
-                    if (is8Bit(operand)) {
-                        decodedOperandStr = REGISTERS8.at(regIdx);
-                    } else if (is16Bit(operand)) {
-                        decodedOperandStr = REGISTERS16.at(regIdx);
-                    } else if (is32Bit(operand)) {
-                        decodedOperandStr = REGISTERS32.at(regIdx);
-                    } else if (is64Bit(operand)) {
-                        decodedOperandStr = REGISTERS64.at(regIdx);
-                    } else if (operand == Operand::xm128) {
-                        decodedOperandStr = "xmm" + remOps[0];
+                    // the register is encoded in the opcode (e.g. 50+rd)
+                    if (remOp[0] < '0' || remOp[0] > '7') {
+                        status = DecodeStatus::INVALID_OPERAND;
+                        return false;
                     }
-                }
-
-                if ((isRM(operand) || isM(operand)) && hasModrm(opEnc) &&
-                    modrm.hasSib) {
-                    decodedOperandStr = sib.getAddr(operand, disp8, disp32);
-                }
-                if (hasSegmentOverridePrefix) {
-                    decodedOperandStr =
-                        prefixSegmentOverrideStr + ":" + decodedOperandStr;
+                    reg = (remOp[0] - '0') | rexB(rexByte);
                 }
             } else if (isIMM(operand)) {
-                int immSize = 0;
-                if (operand == Operand::imm64 || operand == Operand::ymm) {
+                if (operand == Operand::imm64) {
                     immSize = 8;
-                } else if (operand == Operand::imm32 ||
-                           operand == Operand::xmm) {
+                } else if (operand == Operand::imm32) {
                     immSize = 4;
                 } else if (operand == Operand::imm16) {
                     immSize = 2;
-                } else if (operand == Operand::imm8) {
+                } else {
                     immSize = 1;
                 }
-                imm = std::vector<uint8_t>(
-                    objectSource.begin() + curAddr,
-                    objectSource.begin() + curAddr + immSize);
-                std::reverse(imm.begin(), imm.end());
-                disassembledInstructionSize += immSize;
-                curAddr += immSize;
-
-                std::stringstream ss;
-                ss << "0x";
-                for (unsigned char x : imm) {
-                    ss << std::hex << std::setw(2) << std::setfill('0')
-                       << static_cast<int>(x);
+                if (!readLittleEndian<checked>(immSize, imm)) {
+                    return false;
                 }
-                decodedOperandStr = ss.str();
             }
 
-            disassembledOperands.emplace_back(decodedOperandStr);
+            decodedOperands[i] = {operand, reg};
         }
+        return true;
+    }
 
-        std::string ao = "";
-        for (std::string& a : disassembledOperands) {
-            ao += " " + a;
+    /**
+     * @brief Parses all the parts of an instruction.
+     * @tparam checked Whether to check the bounds of every read.
+     * @param startAddr The starting address of the instruction.
+     * @return False if the instruction cannot be decoded (see status).
+     */
+    template <bool checked>
+    bool parse(uint64_t startAddr) {
+        // the general format of the x86-64 operations
+        // |prefix|REX prefix|opcode|ModR/M|SIB|address offset|immediate|
+
+        if (parseEndBr<checked>()) {
+            return true;
+        }
+        parseLegacyPrefixes<checked>(startAddr);
+        parseREX<checked>();
+        return parseOpcode<checked>() && parseModRM() &&
+               parseSIB<checked>() && parseAddressOffset<checked>() &&
+               parseOperands<checked>();
+    }
+
+    /**
+     * @brief Executes a step in disassembling the instruction.
+     * @param startAddr The starting address of the instruction.
+     * @return The decoded instruction. If it cannot be decoded, its status
+     * tells why, and only the prefix and the opcode are filled in.
+     */
+    DecodedInstruction step(uint64_t startAddr) {
+        // ############### Initialize ##############################
+        curAddr = startAddr;
+
+        // Far enough from the end, even the longest encoding stays within
+        // the padding, so the reads need no bounds checks.
+        bool fast = padded && startAddr < objectSize &&
+                    objectSize - startAddr >= MAX_DECODE_READ - DECODE_PADDING;
+        bool parsed = fast ? parse<false>(startAddr) : parse<true>(startAddr);
+
+        // prefixes may make an encoding longer than the architecture allows
+        if (parsed && disassembledInstructionSize > MAX_INSTRUCTION_LENGTH) {
+            status = DecodeStatus::TOO_LONG;
+            parsed = false;
         }
-        disassembledInstruction.emplace_back(ao);
-
-        long long nextOffset = 0;
-        std::string disassembledInstructionStr = "";
-
-        if (isControlFlowInstruction(mnemonic) && operands.size() == 1 &&
-            isIMM(operands[0])) {
-            nextOffset = decodeOffset(disassembledOperands[0]);
-            uint64_t labelAddr =
-                (uint64_t)(((long long)startAddr) +
-                           ((long long)disassembledInstructionSize) +
-                           nextOffset);
-            std::stringstream ss;
-            ss << std::hex << labelAddr;
-            std::string labelName = ss.str();
-            if (addr2symbol.find(labelAddr) != addr2symbol.end()) {
-                labelName += " <" + addr2symbol.at(labelAddr) + ">";
+
+        // clamp the instruction to the end of the object code
+        if (parsed && disassembledInstructionSize > objectSize - startAddr) {
+            status = DecodeStatus::TRUNCATED;
+            parsed = false;
+        }
+
+        if (!parsed) {
+            DecodedInstruction failure = {};
+            failure.startAddr = startAddr;
+            failure.status = status;
+            failure.length = disassembledInstructionSize;
+            failure.mnemonic = Mnemonic::INVALID;
+            failure.prefix = prefix;
+            failure.opcode = opcodeByte;
+            return failure;
+        }
+
+        DecodedInstruction instruction = {};
+        instruction.startAddr = startAddr;
+        instruction.status = DecodeStatus::OK;
+        instruction.length = disassembledInstructionSize;
+        instruction.mnemonic = mnemonic;
+        instruction.prefix = prefix;
+        instruction.opEnc = opEnc;
+        instruction.opcode = opcodeByte;
+        instruction.legacyPrefixes = legacyPrefixes;
+        instruction.instructionPrefix = instructionPrefixByte;
+        instruction.segmentPrefix = segmentOverridePrefixByte;
+        instruction.rex = rexByte;
+        instruction.hasModrm = hasModrm(opEnc);
+        instruction.hasSib = instruction.hasModrm && modrm.hasSib;
+        instruction.modrm = instruction.hasModrm ? modrmByte : 0;
+        instruction.sib = instruction.hasSib ? sibByte : 0;
+        instruction.base = NO_REG;
+        instruction.index = NO_REG;
+        instruction.scale = 1;
+        if (instruction.hasSib) {
+            if (!(sib.baseByte == 5 && modrm.modByte == 0)) {
+                instruction.base = sib.baseByte | rexB(rexByte);
             }
-            disassembledInstructionStr =
-                to_string(mnemonic) + " " + labelName +
-                " ; relative offset = " + std::to_string(nextOffset);
-        } else {
-            disassembledInstructionStr = disassembledInstruction[0];
-            for (int i = 1; i < disassembledInstruction.size(); i++) {
-                disassembledInstructionStr += " " + disassembledInstruction[i];
+            if ((sib.indexByte | rexX(rexByte)) != 4) {
+                instruction.index = sib.indexByte | rexX(rexByte);
+                instruction.scale = sib.scale;
             }
+        } else if (instruction.hasModrm && modrm.modByte != 3) {
+            instruction.base = modrm.isRipRel
+                                   ? RIP_REG
+                                   : modrm.rmByte | rexB(rexByte);
         }
-
-        return {startAddr, disassembledInstructionSize, mnemonic,
-                disassembledInstructionStr, nextOffset};
+        instruction.dispSize = hasDisp32 ? 4 : (hasDisp8 ? 1 : 0);
+        instruction.disp = disp;
+        instruction.immSize = immSize;
+        instruction.imm = imm;
+        instruction.numOperands = numOperands;
+        for (int i = 0; i < numOperands; i++) {
+            instruction.operands[i] = decodedOperands[i];
+        }
+        return instruction;
     }
 };
+
+// Decoding must not allocate, so State must not own any heap memory.
+static_assert(std::is_trivially_destructible<State>::value,
+              "State must not own heap memory");
+
+/**
+ * @brief Decodes consecutive instructions of [begin, end) into a
+ * caller-provided array. An instruction that cannot be decoded is written
+ * with its status set and a length of 1, and decoding resumes at the next
+ * byte, as in the linear sweep.
+ * @param begin The first byte to decode.
+ * @param end The end of the object code. Instructions are clamped to it.
+ * @param baseAddr The address of begin.
+ * @param out The array to write the decoded instructions to.
+ * @param cap The capacity of out.
+ * @param padded Whether at least DECODE_PADDING bytes after end are readable.
+ * @return The number of instructions written to out.
+ */
+inline size_t decodeBlock(const uint8_t* begin, const uint8_t* end,
+                          uint64_t baseAddr, DecodedInstruction* out,
+                          size_t cap, bool padded = false) {
+    size_t n = 0;
+    uint64_t offset = 0;
+    uint64_t size = end - begin;
+    while (n < cap && offset < size) {
+        State state(begin, end, padded);
+        DecodedInstruction& instruction = out[n++];
+        instruction = state.step(offset);
+        if (instruction.status != DecodeStatus::OK) {
+            instruction.length = 1;
+        }
+        instruction.startAddr += baseAddr;
+        offset += instruction.length;
+    }
+    return n;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file
+ * @brief Defines the address-ordered store of disassembled instructions.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arena.h"
+
+/**
+ * @struct InstructionRecord
+ * @brief A disassembled instruction (or a run of undecodable bytes).
+ */
+struct InstructionRecord {
+    uint64_t startAddr;    /**< The starting address */
+    uint64_t endAddr;      /**< The address just after the last byte */
+    std::string_view text; /**< The instruction text, owned by the arena of
+                              the store */
+
+    /**
+     * @brief Gets the length of the instruction in bytes.
+     * @return The length.
+     */
+    uint64_t length() const { return endAddr - startAddr; }
+};
+
+/**
+ * @struct InstructionStore
+ * @brief Contiguous array of instruction records ordered by address.
+ *
+ * The linear sweep appends records in address order, so it never pays for
+ * sorting. Records appended out of order (e.g. by the recursive descent)
+ * are sorted once, on the first lookup or iteration after the append.
+ * The text of the records lives in one string arena, which is freed with
+ * the store.
+ */
+struct InstructionStore {
+    /**
+     * @brief Appends a record. A later record with the same range replaces
+     * an earlier one.
+     * @param startAddr The starting address.
+     * @param endAddr The address just after the last byte.
+     * @param text The instruction text, copied into the arena.
+     */
+    void add(uint64_t startAddr, uint64_t endAddr, std::string_view text) {
+        if (!records.empty() && !isBefore(records.back(), startAddr, endAddr)) {
+            sorted = false;
+        }
+        records.push_back({startAddr, endAddr, arena.store(text)});
+    }
+
+    /**
+     * @brief Finds the record of the given range in O(log n).
+     * @param startAddr The starting address.
+     * @param endAddr The address just after the last byte.
+     * @return The record, or nullptr if there is none.
+     */
+    const InstructionRecord *find(uint64_t startAddr, uint64_t endAddr) {
+        sort();
+        auto it = std::lower_bound(
+            records.begin(), records.end(), std::make_pair(startAddr, endAddr),
+            [](const InstructionRecord &record,
+               const std::pair<uint64_t, uint64_t> &key) {
+                return isBefore(record, key.first, key.second);
+            });
+        if (it == records.end() || it->startAddr != startAddr ||
+            it->endAddr != endAddr) {
+            return nullptr;
+        }
+        return &*it;
+    }
+
+    /**
+     * @brief Gets the text of the record of the given range.
+     * @param startAddr The starting address.
+     * @param endAddr The address just after the last byte.
+     * @return The text, or an empty string if there is no such record.
+     */
+    std::string_view text(uint64_t startAddr, uint64_t endAddr) {
+        const InstructionRecord *record = find(startAddr, endAddr);
+        return record == nullptr ? "" : record->text;
+    }
+
+    /**
+     * @brief Gets the records ordered by address.
+     * @return The records.
+     */
+    const std::vector<InstructionRecord> &ordered() {
+        sort();
+        return records;
+    }
+
+    /**
+     * @brief Gets the number of records.
+     * @return The number of records.
+     */
+    size_t size() {
+        sort();
+        return records.size();
+    }
+
+    /**
+     * @brief Removes all records and frees their text.
+     */
+    void clear() {
+        records.clear();
+        arena.clear();
+        sorted = true;
+    }
+
+   private:
+    std::vector<InstructionRecord> records; /**< The records */
+    StringArena arena;                      /**< The text of the records */
+    bool sorted = true; /**< Whether records are ordered and unique */
+
+    static bool isBefore(const InstructionRecord &record, uint64_t startAddr,
+                         uint64_t endAddr) {
+        return record.startAddr < startAddr ||
+               (record.startAddr == startAddr && record.endAddr < endAddr);
+    }
+
+    void sort() {
+        if (sorted) {
+            return;
+        }
+        std::stable_sort(records.begin(), records.end(),
+                         [](const InstructionRecord &a,
+                            const InstructionRecord &b) {
+                             return isBefore(a, b.startAddr, b.endAddr);
+                         });
+        // keep the last of the records with the same range
+        size_t out = 0;
+        for (size_t i = 0; i < records.size(); i++) {
+            if (i + 1 < records.size() &&
+                records[i + 1].startAddr == records[i].startAddr &&
+                records[i + 1].endAddr == records[i].endAddr) {
+                continue;
+            }
+            if (out != i) {
+                records[out] = std::move(records[i]);
+            }
+            out++;
+        }
+        records.resize(out);
+        sorted = true;
+    }
+};
@@ -0,0 +1,180 @@
+/**
+ * @file
+ * @brief Defines the address-ordered index of symbols.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arena.h"
+
+/**
+ * @struct SymbolIndex
+ * @brief Symbols sorted by address. The addresses are kept in one array and
+ * the names in another, so that lookups are binary searches over contiguous
+ * addresses. Names are views, usually into the string tables of the mapped
+ * object file, so that symbols are indexed without copying their names.
+ *
+ * Symbols are added with add() or addView() and become visible to lookups
+ * after sort().
+ * A sorted index is read-only and may be shared between threads.
+ */
+struct SymbolIndex {
+    /**
+     * @struct Match
+     * @brief The result of a lookup.
+     */
+    struct Match {
+        std::string_view name; /**< The name of the symbol, or empty if no
+                                  symbol was found */
+        uint64_t offset;       /**< The distance from the symbol */
+
+        explicit operator bool() const { return !name.empty(); }
+    };
+
+    /**
+     * @brief Adds a symbol, keeping a copy of its name. If several symbols
+     * share an address, the first one added is kept.
+     * @param addr The address of the symbol.
+     * @param name The name of the symbol.
+     */
+    void add(uint64_t addr, std::string_view name) {
+        addView(addr, ownedNames.store(name));
+    }
+
+    /**
+     * @brief Adds a symbol without copying its name, which must outlive the
+     * index. If several symbols share an address, the first one added is
+     * kept.
+     * @param addr The address of the symbol.
+     * @param name The name of the symbol.
+     */
+    void addView(uint64_t addr, std::string_view name) {
+        addrs.push_back(addr);
+        names.push_back(name);
+        sorted = false;
+    }
+
+    /**
+     * @brief Sorts the symbols by address, keeping the first of any
+     * duplicates.
+     */
+    void sort() {
+        if (sorted) {
+            return;
+        }
+        std::vector<size_t> order(addrs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return addrs[a] < addrs[b];
+        });
+        std::vector<uint64_t> sortedAddrs;
+        std::vector<std::string_view> sortedNames;
+        sortedAddrs.reserve(order.size());
+        sortedNames.reserve(order.size());
+        for (size_t i : order) {
+            if (!sortedAddrs.empty() && sortedAddrs.back() == addrs[i]) {
+                continue;
+            }
+            sortedAddrs.push_back(addrs[i]);
+            sortedNames.push_back(names[i]);
+        }
+        addrs.swap(sortedAddrs);
+        names.swap(sortedNames);
+        sorted = true;
+    }
+
+    /**
+     * @brief Gets the number of symbols.
+     * @return The number of symbols.
+     */
+    size_t size() const { return addrs.size(); }
+
+    /**
+     * @brief Gets the address of the i-th symbol in address order.
+     * @param i The index of the symbol.
+     * @return The address.
+     */
+    uint64_t address(size_t i) const { return addrs[i]; }
+
+    /**
+     * @brief Gets the name of the i-th symbol in address order.
+     * @param i The index of the symbol.
+     * @return The name.
+     */
+    std::string_view name(size_t i) const { return names[i]; }
+
+    /**
+     * @brief Counts the symbols below an address, i.e. finds the index of
+     * the first symbol at or after it.
+     * @param addr The address.
+     * @return The index.
+     */
+    size_t lowerBound(uint64_t addr) const {
+        size_t n = addrs.size();
+        if (n == 0) {
+            return 0;
+        }
+        // halve the range without branching on the comparison
+        const uint64_t *base = addrs.data();
+        while (n > 1) {
+            size_t half = n / 2;
+            base = base[half] < addr ? base + half : base;
+            n -= half;
+        }
+        return (base - addrs.data()) + (*base < addr);
+    }
+
+    /**
+     * @brief Finds the symbol starting exactly at an address.
+     * @param addr The address.
+     * @return The symbol, or an empty match.
+     */
+    Match find(uint64_t addr) const {
+        size_t i = lowerBound(addr);
+        if (i < addrs.size() && addrs[i] == addr) {
+            return Match{name(i), 0};
+        }
+        return Match{std::string_view(), 0};
+    }
+
+    /**
+     * @brief Finds the nearest symbol at or before an address, e.g. for
+     * labelling a target as func+0x1c.
+     * @param addr The address.
+     * @return The symbol and the distance from it, or an empty match.
+     */
+    Match findPreceding(uint64_t addr) const {
+        size_t i = lowerBound(addr);
+        if (i < addrs.size() && addrs[i] == addr) {
+            return Match{name(i), 0};
+        }
+        if (i == 0) {
+            return Match{std::string_view(), 0};
+        }
+        return Match{name(i - 1), addr - addrs[i - 1]};
+    }
+
+    /**
+     * @brief Finds the symbols within an address range.
+     * @param begin The start of the range.
+     * @param end The end of the range (exclusive).
+     * @return The indices [first, last) of the symbols.
+     */
+    std::pair<size_t, size_t> range(uint64_t begin, uint64_t end) const {
+        size_t first = lowerBound(begin);
+        return std::make_pair(first, std::max(first, lowerBound(end)));
+    }
+
+   private:
+    std::vector<uint64_t> addrs;          /**< The addresses of the symbols */
+    std::vector<std::string_view> names;  /**< The names of the symbols */
+    StringArena ownedNames; /**< The names copied by add() */
+    bool sorted = true;     /**< Whether addrs is sorted and unique */
+};
@@ -1,1944 +1,2046 @@
+/**
+ * @file
+ * @brief Defines the compile-time opcode and operand lookup tables.
+ */
+
 #pragma once
-#include <string>
-#include <unordered_map>
-#include <unordered_set>
-#include <vector>
+#include <cstdint>
+#include <initializer_list>
 
 #include "constants.h"
-#include "utils.h"
+
+/**
+ * @brief The maximum number of operands of an instruction.
+ */
+constexpr int MAX_OPERANDS = 3;
+
+/**
+ * @struct OpcodeEntry
+ * @brief Maps (prefix, opcode, reg of ModRM) to a mnemonic. The reg of -1
+ * matches any reg that does not have its own entry.
+ */
+struct OpcodeEntry {
+    Prefix prefix;
+    int opcode;
+    int reg;
+    Mnemonic mnemonic;
+};
+
+/**
+ * @struct OperandEntry
+ * @brief Maps (prefix, mnemonic, opcode) to the operand encoding, the
+ * remaining opcode notation (e.g. "/r", "ib" or the register number "0") and
+ * the operand types.
+ */
+struct OperandEntry {
+    Prefix prefix;
+    Mnemonic mnemonic;
+    int opcode;
+    OpEnc opEnc;
+    const char* remOp;
+    int numOperands;
+    Operand operands[MAX_OPERANDS];
+
+    constexpr OperandEntry(Prefix prefix, Mnemonic mnemonic, int opcode,
+                           OpEnc opEnc, const char* remOp,
+                           std::initializer_list<Operand> ops)
+        : prefix(prefix),
+          mnemonic(mnemonic),
+          opcode(opcode),
+          opEnc(opEnc),
+          remOp(remOp),
+          numOperands(0),
+          operands{} {
+        for (Operand op : ops) {
+            operands[numOperands++] = op;
+        }
+    }
+};
 
 // Global lookup table for instructions
-// (prefix, opcode) -> (reg -> operator)
-const std::unordered_map<std::pair<Prefix, int>,
-                         std::unordered_map<int, Mnemonic>>
-    OP_LOOKUP = {
-        // SETNE
-        {{Prefix::NONE, u2d("\x0F\x95")}, {{-1, Mnemonic::SETNE}}},
-        {{Prefix::REX, u2d("\x0F\x95")}, {{-1, Mnemonic::SETNE}}},
-
-        // FADD
-        {{Prefix::NONE, u2d("\xD8")}, {{0, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC")}, {{0, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC0")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC1")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC2")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC3")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC4")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC5")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC6")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xD8\xC7")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC0")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC1")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC2")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC3")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC4")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC5")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC6")}, {{-1, Mnemonic::FADD}}},
-        {{Prefix::NONE, u2d("\xDC\xC7")}, {{-1, Mnemonic::FADD}}},
-
-        // FXCH
-        {{Prefix::NONE, u2d("\xD9\xC8")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xC9")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xCA")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xCB")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xCC")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xCD")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xCE")}, {{-1, Mnemonic::FXCH}}},
-        {{Prefix::NONE, u2d("\xD9\xCF")}, {{-1, Mnemonic::FXCH}}},
-
-        // CMOVE
-        {{Prefix::NONE, u2d("\x0F\x44")}, {{-1, Mnemonic::CMOVE}}},
-
-        // MOVAPS
-        {{Prefix::NONE, u2d("\x0F\x28")}, {{-1, Mnemonic::MOVAPS}}},
-        {{Prefix::NONE, u2d("\x0F\x29")}, {{-1, Mnemonic::MOVAPS}}},
-
-        // ENDBR
-        {{Prefix::NONE, u2d("\xF3\x0F\x1E\xFA")}, {{-1, Mnemonic::ENDBR64}}},
-        {{Prefix::NONE, u2d("\xF3\x0F\x1E\xFB")}, {{-1, Mnemonic::ENDBR32}}},
-
-        // IN
-        {{Prefix::NONE, u2d("\xE4")}, {{-1, Mnemonic::IN}}},
-        {{Prefix::NONE, u2d("\xE5")}, {{-1, Mnemonic::IN}}},
-        {{Prefix::NONE, u2d("\xEC")}, {{-1, Mnemonic::IN}}},
-        {{Prefix::NONE, u2d("\xED")}, {{-1, Mnemonic::IN}}},
-
-        // OUT
-        {{Prefix::NONE, u2d("\xE6")}, {{-1, Mnemonic::OUT}}},
-        {{Prefix::NONE, u2d("\xE7")}, {{-1, Mnemonic::OUT}}},
-        {{Prefix::NONE, u2d("\xEE")}, {{-1, Mnemonic::OUT}}},
-        {{Prefix::NONE, u2d("\xEF")}, {{-1, Mnemonic::OUT}}},
-
-        // LOOP
-        {{Prefix::NONE, u2d("\xE2")}, {{-1, Mnemonic::LOOP}}},
-        {{Prefix::NONE, u2d("\xE1")}, {{-1, Mnemonic::LOOPE}}},
-        {{Prefix::NONE, u2d("\xE0")}, {{-1, Mnemonic::LOOPNE}}},
-
-        {{Prefix::NONE, u2d("\xE3")}, {{-1, Mnemonic::JECXZ}}},
-        {{Prefix::NONE, u2d("\x6C")}, {{-1, Mnemonic::INSB}}},
-        {{Prefix::NONE, u2d("\x6D")}, {{-1, Mnemonic::INSW}}},
-        {{Prefix::NONE, u2d("\x6E")}, {{-1, Mnemonic::OUTSB}}},
-        {{Prefix::NONE, u2d("\x6F")}, {{-1, Mnemonic::OUTSW}}},
-        {{Prefix::NONE, u2d("\xAE")}, {{-1, Mnemonic::SCASB}}},
-        {{Prefix::NONE, u2d("\xAF")}, {{-1, Mnemonic::SCASW}}},
-        {{Prefix::REXW, u2d("\xAF")}, {{-1, Mnemonic::SCASQ}}},
-        {{Prefix::NONE, u2d("\xAA")}, {{-1, Mnemonic::STOSB}}},
-        {{Prefix::NONE, u2d("\xAB")}, {{-1, Mnemonic::STOSW}}},
-        {{Prefix::REXW, u2d("\xAB")}, {{-1, Mnemonic::STOSQ}}},
-        {{Prefix::NONE, u2d("\xAC")}, {{-1, Mnemonic::LODSB}}},
-        {{Prefix::NONE, u2d("\xAD")}, {{-1, Mnemonic::LODSW}}},
-        {{Prefix::REXW, u2d("\xAD")}, {{-1, Mnemonic::LODSQ}}},
-        {{Prefix::NONE, u2d("\xA4")}, {{-1, Mnemonic::MOVSB}}},
-        {{Prefix::NONE, u2d("\xA5")}, {{-1, Mnemonic::MOVSW}}},
-        {{Prefix::REXW, u2d("\xA5")}, {{-1, Mnemonic::MOVSQ}}},
-        {{Prefix::NONE, u2d("\xA6")}, {{-1, Mnemonic::CMPSB}}},
-        {{Prefix::NONE, u2d("\xA7")}, {{-1, Mnemonic::CMPSW}}},
-        {{Prefix::REXW, u2d("\xA7")}, {{-1, Mnemonic::CMPSQ}}},
-        {{Prefix::NONE, u2d("\xC9")}, {{-1, Mnemonic::LEAVE}}},
-        {{Prefix::NONE, u2d("\x0F\xA2")}, {{-1, Mnemonic::CPUID}}},
-        {{Prefix::NONE, u2d("\xF8")}, {{-1, Mnemonic::CLC}}},
-        {{Prefix::NONE, u2d("\xFC")}, {{-1, Mnemonic::CLD}}},
-        {{Prefix::NONE, u2d("\xF9")}, {{-1, Mnemonic::STC}}},
-
-        // ADD, ADC, SUB, SBB, AND, OR, XOR, CMP
-        {{Prefix::NONE, u2d("\x04")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::NONE, u2d("\x14")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::NONE, u2d("\x2C")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::NONE, u2d("\x1C")}, {{-1, Mnemonic::SBB}}},
-
-        {{Prefix::NONE, u2d("\x24")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x0C")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x34")}, {{-1, Mnemonic::XOR}}},
-
-        {{Prefix::NONE, u2d("\x3C")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::NONE, u2d("\x3D")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::REXW, u2d("\x3D")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::NONE, u2d("\x38")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::REX, u2d("\x38")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::NONE, u2d("\x39")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::REXW, u2d("\x39")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::NONE, u2d("\x3A")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::REX, u2d("\x3A")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::NONE, u2d("\x3B")}, {{-1, Mnemonic::CMP}}},
-        {{Prefix::REXW, u2d("\x3B")}, {{-1, Mnemonic::CMP}}},
-
-        {{Prefix::NONE, u2d("\x05")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::REXW, u2d("\x05")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::NONE, u2d("\x15")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::REXW, u2d("\x15")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::NONE, u2d("\x2D")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::REXW, u2d("\x2D")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::NONE, u2d("\x1D")}, {{-1, Mnemonic::SBB}}},
-        {{Prefix::REXW, u2d("\x1D")}, {{-1, Mnemonic::SBB}}},
-
-        {{Prefix::NONE, u2d("\x25")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::REXW, u2d("\x25")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::P66, u2d("\x25")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x0D")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::REXW, u2d("\x0D")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::P66, u2d("\x0D")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x35")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::REXW, u2d("\x35")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::P66, u2d("\x35")}, {{-1, Mnemonic::XOR}}},
-
-        {{Prefix::NONE, u2d("\x80")},
-         {{0, Mnemonic::ADD},
-          {2, Mnemonic::ADC},
-          {5, Mnemonic::SUB},
-          {3, Mnemonic::SBB},
-          {4, Mnemonic::AND},
-          {1, Mnemonic::OR},
-          {6, Mnemonic::XOR},
-          {7, Mnemonic::CMP}}},
-        {{Prefix::REX, u2d("\x80")},
-         {{0, Mnemonic::ADD},
-          {2, Mnemonic::ADC},
-          {5, Mnemonic::SUB},
-          {3, Mnemonic::SBB},
-          {4, Mnemonic::AND},
-          {1, Mnemonic::OR},
-          {6, Mnemonic::XOR},
-          {7, Mnemonic::CMP}}},
-
-        {{Prefix::NONE, u2d("\x81")},
-         {{0, Mnemonic::ADD},
-          {2, Mnemonic::ADC},
-          {5, Mnemonic::SUB},
-          {3, Mnemonic::SBB},
-          {4, Mnemonic::AND},
-          {1, Mnemonic::OR},
-          {6, Mnemonic::XOR},
-          {7, Mnemonic::CMP}}},
-        {{Prefix::REXW, u2d("\x81")},
-         {{0, Mnemonic::ADD},
-          {2, Mnemonic::ADC},
-          {5, Mnemonic::SUB},
-          {3, Mnemonic::SBB},
-          {4, Mnemonic::AND},
-          {1, Mnemonic::OR},
-          {6, Mnemonic::XOR},
-          {7, Mnemonic::CMP}}},
-
-        {{Prefix::NONE, u2d("\x83")},
-         {{0, Mnemonic::ADD},
-          {2, Mnemonic::ADC},
-          {5, Mnemonic::SUB},
-          {3, Mnemonic::SBB},
-          {4, Mnemonic::AND},
-          {1, Mnemonic::OR},
-          {6, Mnemonic::XOR},
-          {7, Mnemonic::CMP}}},
-        {{Prefix::REXW, u2d("\x83")},
-         {{0, Mnemonic::ADD},
-          {2, Mnemonic::ADC},
-          {5, Mnemonic::SUB},
-          {3, Mnemonic::SBB},
-          {4, Mnemonic::AND},
-          {1, Mnemonic::OR},
-          {6, Mnemonic::XOR},
-          {7, Mnemonic::CMP}}},
-
-        {{Prefix::NONE, u2d("\x00")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::REX, u2d("\x00")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::NONE, u2d("\x10")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::REX, u2d("\x10")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::NONE, u2d("\x28")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::REX, u2d("\x28")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::NONE, u2d("\x18")}, {{-1, Mnemonic::SBB}}},
-        {{Prefix::REX, u2d("\x18")}, {{-1, Mnemonic::SBB}}},
-        {{Prefix::NONE, u2d("\x20")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::REX, u2d("\x20")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x08")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::REX, u2d("\x08")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x30")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::REX, u2d("\x30")}, {{-1, Mnemonic::XOR}}},
-
-        {{Prefix::NONE, u2d("\x01")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::REXW, u2d("\x01")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::NONE, u2d("\x11")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::REXW, u2d("\x11")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::NONE, u2d("\x29")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::REXW, u2d("\x29")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::NONE, u2d("\x19")}, {{-1, Mnemonic::SBB}}},
-        {{Prefix::REXW, u2d("\x19")}, {{-1, Mnemonic::SBB}}},
-
-        {{Prefix::NONE, u2d("\x20")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::REXW, u2d("\x20")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::P66, u2d("\x20")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x08")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::REXW, u2d("\x08")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::P66, u2d("\x08")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x30")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::REXW, u2d("\x30")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::P66, u2d("\x30")}, {{-1, Mnemonic::XOR}}},
-
-        {{Prefix::NONE, u2d("\x02")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::REX, u2d("\x02")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::NONE, u2d("\x12")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::REX, u2d("\x12")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::NONE, u2d("\x2A")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::REX, u2d("\x2A")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::NONE, u2d("\x1A")}, {{-1, Mnemonic::SBB}}},
-        {{Prefix::REX, u2d("\x1A")}, {{-1, Mnemonic::SBB}}},
-
-        {{Prefix::NONE, u2d("\x21")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::REXW, u2d("\x21")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::P66, u2d("\x21")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x09")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::REXW, u2d("\x09")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::P66, u2d("\x09")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x31")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::REXW, u2d("\x31")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::P66, u2d("\x31")}, {{-1, Mnemonic::XOR}}},
-
-        {{Prefix::NONE, u2d("\x03")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::REXW, u2d("\x03")}, {{-1, Mnemonic::ADD}}},
-        {{Prefix::NONE, u2d("\x13")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::REXW, u2d("\x13")}, {{-1, Mnemonic::ADC}}},
-        {{Prefix::NONE, u2d("\x2B")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::REXW, u2d("\x2B")}, {{-1, Mnemonic::SUB}}},
-        {{Prefix::NONE, u2d("\x1B")}, {{-1, Mnemonic::SBB}}},
-        {{Prefix::REXW, u2d("\x1B")}, {{-1, Mnemonic::SBB}}},
-
-        {{Prefix::NONE, u2d("\x22")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::REX, u2d("\x22")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x0A")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::REX, u2d("\x0A")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x32")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::REX, u2d("\x32")}, {{-1, Mnemonic::XOR}}},
-
-        {{Prefix::NONE, u2d("\x23")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::REXW, u2d("\x23")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::P66, u2d("\x23")}, {{-1, Mnemonic::AND}}},
-        {{Prefix::NONE, u2d("\x0B")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::REXW, u2d("\x0B")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::P66, u2d("\x0B")}, {{-1, Mnemonic::OR}}},
-        {{Prefix::NONE, u2d("\x33")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::REXW, u2d("\x33")}, {{-1, Mnemonic::XOR}}},
-        {{Prefix::P66, u2d("\x33")}, {{-1, Mnemonic::XOR}}},
-
-        // MOV
-        {{Prefix::NONE, u2d("\x88")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\x88")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::P66, u2d("\x89")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\x89")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\x89")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\x8A")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\x8A")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::P66, u2d("\x8B")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\x8B")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\x8B")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\x8C")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\x8C")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\x8E")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\x8E")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\xA0")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xA0")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::P66, u2d("\xA1")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xA1")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xA1")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\xA2")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xA2")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\xA3")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xA3")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::NONE, u2d("\xB0")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB0")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB1")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB1")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB2")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB2")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB3")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB3")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB4")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB4")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB5")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB5")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB6")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB6")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB7")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xB7")}, {{-1, Mnemonic::MOV}}},
-
-        {{Prefix::P66, u2d("\xB8")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB8")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xB8")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xB9")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xB9")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xB9")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xBA")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xBA")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xBA")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xBB")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xBB")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xBB")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xBC")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xBC")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xBC")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xBD")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xBD")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xBD")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xBE")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xBE")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xBE")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xBF")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xBF")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xBF")}, {{-1, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xC6")}, {{0, Mnemonic::MOV}}},
-        {{Prefix::REX, u2d("\xC6")}, {{0, Mnemonic::MOV}}},
-        {{Prefix::P66, u2d("\xC7")}, {{0, Mnemonic::MOV}}},
-        {{Prefix::NONE, u2d("\xC7")}, {{0, Mnemonic::MOV}}},
-        {{Prefix::REXW, u2d("\xC7")}, {{0, Mnemonic::MOV}}},
-
-        // NEG, NOT, MUL, IMUL, DIV, IDIV, TEST
-        {{Prefix::NONE, u2d("\xF6")},
-         {{3, Mnemonic::NEG},
-          {2, Mnemonic::NOT},
-          {4, Mnemonic::MUL},
-          {5, Mnemonic::IMUL},
-          {6, Mnemonic::DIV},
-          {7, Mnemonic::IDIV},
-          {0, Mnemonic::TEST}}},
-        {{Prefix::REX, u2d("\xF6")},
-         {{3, Mnemonic::NEG},
-          {2, Mnemonic::NOT},
-          {4, Mnemonic::MUL},
-          {5, Mnemonic::IMUL},
-          {6, Mnemonic::DIV},
-          {7, Mnemonic::IDIV},
-          {0, Mnemonic::TEST}}},
-
-        {{Prefix::P66, u2d("\xF7")},
-         {{2, Mnemonic::NOT},
-          {4, Mnemonic::MUL},
-          {5, Mnemonic::IMUL},
-          {6, Mnemonic::DIV},
-          {7, Mnemonic::IDIV},
-          {0, Mnemonic::TEST}}},
-        {{Prefix::NONE, u2d("\xF7")},
-         {{3, Mnemonic::NEG},
-          {2, Mnemonic::NOT},
-          {4, Mnemonic::MUL},
-          {5, Mnemonic::IMUL},
-          {6, Mnemonic::DIV},
-          {7, Mnemonic::IDIV},
-          {0, Mnemonic::TEST}}},
-        {{Prefix::REXW, u2d("\xF7")},
-         {{3, Mnemonic::NEG},
-          {2, Mnemonic::NOT},
-          {4, Mnemonic::MUL},
-          {5, Mnemonic::IMUL},
-          {6, Mnemonic::DIV},
-          {7, Mnemonic::IDIV},
-          {0, Mnemonic::TEST}}},
-
-        {{Prefix::NONE, u2d("\x84")}, {{-1, Mnemonic::TEST}}},
-        {{Prefix::REX, u2d("\x84")}, {{-1, Mnemonic::TEST}}},
-        {{Prefix::NONE, u2d("\x85")}, {{-1, Mnemonic::TEST}}},
-        {{Prefix::REXW, u2d("\x85")}, {{-1, Mnemonic::TEST}}},
-
-        {{Prefix::P66, u2d("\x0F\xAF")}, {{-1, Mnemonic::IMUL}}},
-        {{Prefix::NONE, u2d("\x0F\xAF")}, {{-1, Mnemonic::IMUL}}},
-        {{Prefix::REXW, u2d("\x0F\xAF")}, {{-1, Mnemonic::IMUL}}},
-
-        {{Prefix::P66, u2d("\x6B")}, {{-1, Mnemonic::IMUL}}},
-        {{Prefix::NONE, u2d("\x6B")}, {{-1, Mnemonic::IMUL}}},
-        {{Prefix::REXW, u2d("\x6B")}, {{-1, Mnemonic::IMUL}}},
-
-        {{Prefix::P66, u2d("\x69")}, {{-1, Mnemonic::IMUL}}},
-        {{Prefix::NONE, u2d("\x69")}, {{-1, Mnemonic::IMUL}}},
-        {{Prefix::REXW, u2d("\x69")}, {{-1, Mnemonic::IMUL}}},
-
-        {{Prefix::NONE, u2d("\xA8")}, {{-1, Mnemonic::TEST}}},
-        {{Prefix::P66, u2d("\xA9")}, {{-1, Mnemonic::TEST}}},
-        {{Prefix::NONE, u2d("\xA9")}, {{-1, Mnemonic::TEST}}},
-        {{Prefix::REXW, u2d("\xA9")}, {{-1, Mnemonic::TEST}}},
-
-        // INC, DEC
-        {{Prefix::NONE, u2d("\xFE")}, {{0, Mnemonic::INC}, {1, Mnemonic::DEC}}},
-        {{Prefix::REX, u2d("\xFE")}, {{0, Mnemonic::INC}, {1, Mnemonic::DEC}}},
-        {{Prefix::REXW, u2d("\xFE")}, {{0, Mnemonic::INC}, {1, Mnemonic::DEC}}},
-
-        // CBW, CWDE, CDQE
-        {{Prefix::P66, u2d("\x98")}, {{-1, Mnemonic::CBW}}},
-        {{Prefix::NONE, u2d("\x98")}, {{-1, Mnemonic::CWDE}}},
-        {{Prefix::REXW, u2d("\x98")}, {{-1, Mnemonic::CDQE}}},
-
-        // CWD, CDQ, CQO
-        {{Prefix::P66, u2d("\x98")}, {{-1, Mnemonic::CWD}}},
-        {{Prefix::NONE, u2d("\x98")}, {{-1, Mnemonic::CDQ}}},
-        {{Prefix::REXW, u2d("\x98")}, {{-1, Mnemonic::CQO}}},
-
-        // MOVSX
-        {{Prefix::P66, u2d("\x0F\xBE")}, {{-1, Mnemonic::MOVSX}}},
-        {{Prefix::NONE, u2d("\x0F\xBE")}, {{-1, Mnemonic::MOVSX}}},
-        {{Prefix::REX, u2d("\x0F\xBE")}, {{-1, Mnemonic::MOVSX}}},
-        {{Prefix::NONE, u2d("\x0F\xBF")}, {{-1, Mnemonic::MOVSX}}},
-        {{Prefix::REXW, u2d("\x0F\xBF")}, {{-1, Mnemonic::MOVSX}}},
-
-        // MOVSXD
-        {{Prefix::REXW, u2d("\x63")}, {{-1, Mnemonic::MOVSXD}}},
-
-        // MOVZX
-        {{Prefix::P66, u2d("\x0F\xB6")}, {{-1, Mnemonic::MOVZX}}},
-        {{Prefix::NONE, u2d("\x0F\xB6")}, {{-1, Mnemonic::MOVZX}}},
-        {{Prefix::REX, u2d("\x0F\xB6")}, {{-1, Mnemonic::MOVZX}}},
-        {{Prefix::NONE, u2d("\x0F\xB7")}, {{-1, Mnemonic::MOVZX}}},
-        {{Prefix::REXW, u2d("\x0F\xB7")}, {{-1, Mnemonic::MOVZX}}},
-
-        // LEA
-        {{Prefix::P66, u2d("\x8D")}, {{-1, Mnemonic::LEA}}},
-        {{Prefix::NONE, u2d("\x8D")}, {{-1, Mnemonic::LEA}}},
-        {{Prefix::REXW, u2d("\x8D")}, {{-1, Mnemonic::LEA}}},
-
-        // NOP
-        {{Prefix::NONE, u2d("\x90")}, {{-1, Mnemonic::NOP}}},
-        {{Prefix::NONE, u2d("\x0F\x1F")}, {{0, Mnemonic::NOP}}},
-
-        // RET
-        {{Prefix::NONE, u2d("\xC3")}, {{-1, Mnemonic::RET}}},
-        {{Prefix::NONE, u2d("\xCB")}, {{-1, Mnemonic::RET}}},
-        {{Prefix::NONE, u2d("\xC2")}, {{-1, Mnemonic::RET}}},
-        {{Prefix::NONE, u2d("\xCA")}, {{-1, Mnemonic::RET}}},
-
-        {{Prefix::NONE, u2d("\xFF")},
-         {{0, Mnemonic::INC},
-          {1, Mnemonic::DEC},
-          {2, Mnemonic::CALL},
-          {4, Mnemonic::JMP},
-          {5, Mnemonic::JMP},
-          {6, Mnemonic::PUSH}}},
-
-        // CALL
-        {{Prefix::NONE, u2d("\xE8")}, {{-1, Mnemonic::CALL}}},
-        {{Prefix::NONE, u2d("\x9A")}, {{-1, Mnemonic::CALL}}},
-
-        // JCC
-        {{Prefix::NONE, u2d("\x0F\x80")}, {{-1, Mnemonic::JO}}},
-        {{Prefix::NONE, u2d("\x0F\x81")}, {{-1, Mnemonic::JNO}}},
-        {{Prefix::NONE, u2d("\x0F\x82")}, {{-1, Mnemonic::JNAE}}},
-        {{Prefix::NONE, u2d("\x0F\x83")}, {{-1, Mnemonic::JNB}}},
-        {{Prefix::NONE, u2d("\x0F\x84")}, {{-1, Mnemonic::JZ}}},
-        {{Prefix::NONE, u2d("\x0F\x85")}, {{-1, Mnemonic::JNZ}}},
-        {{Prefix::NONE, u2d("\x0F\x86")}, {{-1, Mnemonic::JNA}}},
-        {{Prefix::NONE, u2d("\x0F\x87")}, {{-1, Mnemonic::JNBE}}},
-        {{Prefix::NONE, u2d("\x0F\x88")}, {{-1, Mnemonic::JS}}},
-        {{Prefix::NONE, u2d("\x0F\x89")}, {{-1, Mnemonic::JNS}}},
-        {{Prefix::NONE, u2d("\x0F\x8A")}, {{-1, Mnemonic::JP}}},
-        {{Prefix::NONE, u2d("\x0F\x8B")}, {{-1, Mnemonic::JPO}}},
-        {{Prefix::NONE, u2d("\x0F\x8C")}, {{-1, Mnemonic::JNGE}}},
-        {{Prefix::NONE, u2d("\x0F\x8D")}, {{-1, Mnemonic::JNL}}},
-        {{Prefix::NONE, u2d("\x0F\x8E")}, {{-1, Mnemonic::JNG}}},
-        {{Prefix::NONE, u2d("\x0F\x8F")}, {{-1, Mnemonic::JNLE}}},
-
-        {{Prefix::NONE, u2d("\x70")}, {{-1, Mnemonic::JO}}},
-        {{Prefix::NONE, u2d("\x71")}, {{-1, Mnemonic::JNO}}},
-        {{Prefix::NONE, u2d("\x72")}, {{-1, Mnemonic::JNAE}}},
-        {{Prefix::NONE, u2d("\x73")}, {{-1, Mnemonic::JNB}}},
-        {{Prefix::NONE, u2d("\x74")}, {{-1, Mnemonic::JZ}}},
-        {{Prefix::NONE, u2d("\x75")}, {{-1, Mnemonic::JNZ}}},
-        {{Prefix::NONE, u2d("\x76")}, {{-1, Mnemonic::JNA}}},
-        {{Prefix::NONE, u2d("\x77")}, {{-1, Mnemonic::JNBE}}},
-        {{Prefix::NONE, u2d("\x78")}, {{-1, Mnemonic::JS}}},
-        {{Prefix::NONE, u2d("\x79")}, {{-1, Mnemonic::JNS}}},
-        {{Prefix::NONE, u2d("\x7A")}, {{-1, Mnemonic::JP}}},
-        {{Prefix::NONE, u2d("\x7B")}, {{-1, Mnemonic::JPO}}},
-        {{Prefix::NONE, u2d("\x7C")}, {{-1, Mnemonic::JNGE}}},
-        {{Prefix::NONE, u2d("\x7D")}, {{-1, Mnemonic::JNL}}},
-        {{Prefix::NONE, u2d("\x7E")}, {{-1, Mnemonic::JNG}}},
-        {{Prefix::NONE, u2d("\x7F")}, {{-1, Mnemonic::JNLE}}},
-
-        // JMP
-        {{Prefix::NONE, u2d("\xEB")}, {{-1, Mnemonic::JMP}}},
-        {{Prefix::NONE, u2d("\xE9")}, {{-1, Mnemonic::JMP}}},
-
-        // BSWAP
-        {{Prefix::NONE, u2d("\x0F\xC8")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xC8")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xC9")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xC9")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xCA")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xCA")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xCB")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xCB")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xCC")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xCC")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xCD")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xCD")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xCE")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xCE")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::NONE, u2d("\x0F\xCF")}, {{-1, Mnemonic::BSWAP}}},
-        {{Prefix::REXW, u2d("\x0F\xCF")}, {{-1, Mnemonic::BSWAP}}},
-
-        // SAL
-        {{Prefix::NONE, u2d("\xD0")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::REX, u2d("\xD0")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-
-        {{Prefix::NONE, u2d("\xD2")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::REX, u2d("\xD2")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-
-        {{Prefix::NONE, u2d("\xC0")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::REX, u2d("\xC0")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-
-        {{Prefix::P66, u2d("\xD1")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::NONE, u2d("\xD1")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::REXW, u2d("\xD1")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-
-        {{Prefix::P66, u2d("\xD3")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::NONE, u2d("\xD3")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::REXW, u2d("\xD3")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-
-        {{Prefix::P66, u2d("\xC1")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::NONE, u2d("\xC1")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-        {{Prefix::REXW, u2d("\xC1")},
-         {{4, Mnemonic::SAL},
-          {7, Mnemonic::SAR},
-          {5, Mnemonic::SHR},
-          {2, Mnemonic::RCL},
-          {3, Mnemonic::RCR},
-          {0, Mnemonic::ROL},
-          {1, Mnemonic::ROR}}},
-
-        {{Prefix::P66, u2d("\x0F\xA4")}, {{-1, Mnemonic::SHLD}}},
-        {{Prefix::NONE, u2d("\x0F\xA4")}, {{-1, Mnemonic::SHLD}}},
-        {{Prefix::REXW, u2d("\x0F\xA4")}, {{-1, Mnemonic::SHLD}}},
-        {{Prefix::P66, u2d("\x0F\xA5")}, {{-1, Mnemonic::SHLD}}},
-        {{Prefix::NONE, u2d("\x0F\xA5")}, {{-1, Mnemonic::SHLD}}},
-        {{Prefix::REXW, u2d("\x0F\xA5")}, {{-1, Mnemonic::SHLD}}},
-
-        {{Prefix::P66, u2d("\x0F\xAC")}, {{-1, Mnemonic::SHRD}}},
-        {{Prefix::NONE, u2d("\x0F\xAC")}, {{-1, Mnemonic::SHRD}}},
-        {{Prefix::REXW, u2d("\x0F\xAC")}, {{-1, Mnemonic::SHRD}}},
-        {{Prefix::P66, u2d("\x0F\xAD")}, {{-1, Mnemonic::SHRD}}},
-        {{Prefix::NONE, u2d("\x0F\xAD")}, {{-1, Mnemonic::SHRD}}},
-        {{Prefix::REXW, u2d("\x0F\xAD")}, {{-1, Mnemonic::SHRD}}},
-
-        // POP
-        {{Prefix::NONE, u2d("\x8F")}, {{0, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x58")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x59")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x5A")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x5B")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x5C")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x5D")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x5E")}, {{-1, Mnemonic::POP}}},
-        {{Prefix::NONE, u2d("\x5F")}, {{-1, Mnemonic::POP}}},
-
-        // PUSH
-        {{Prefix::NONE, u2d("\x50")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x51")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x52")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x53")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x54")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x55")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x56")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x57")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x6A")}, {{-1, Mnemonic::PUSH}}},
-        {{Prefix::NONE, u2d("\x68")}, {{-1, Mnemonic::PUSH}}},
+// (prefix, opcode, reg) -> operator
+// ENDBR64/ENDBR32 (F3 0F 1E FA/FB) are decoded by State::parseEndBr.
+inline constexpr OpcodeEntry OP_ENTRIES[] = {
+    // SETNE
+    {Prefix::NONE, 0x0F95, -1, Mnemonic::SETNE},
+    {Prefix::REX, 0x0F95, -1, Mnemonic::SETNE},
+
+    // FADD
+    {Prefix::NONE, 0xD8, 0, Mnemonic::FADD},
+    {Prefix::NONE, 0xDC, 0, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C0, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C1, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C2, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C3, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C4, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C5, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C6, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xD8C7, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC0, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC1, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC2, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC3, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC4, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC5, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC6, -1, Mnemonic::FADD},
+    {Prefix::NONE, 0xDCC7, -1, Mnemonic::FADD},
+
+    // FXCH
+    {Prefix::NONE, 0xD9C8, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9C9, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9CA, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9CB, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9CC, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9CD, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9CE, -1, Mnemonic::FXCH},
+    {Prefix::NONE, 0xD9CF, -1, Mnemonic::FXCH},
+
+    // CMOVE
+    {Prefix::NONE, 0x0F44, -1, Mnemonic::CMOVE},
+
+    // MOVAPS
+    {Prefix::NONE, 0x0F28, -1, Mnemonic::MOVAPS},
+    {Prefix::NONE, 0x0F29, -1, Mnemonic::MOVAPS},
+
+    
+
+    // IN
+    {Prefix::NONE, 0xE4, -1, Mnemonic::IN},
+    {Prefix::NONE, 0xE5, -1, Mnemonic::IN},
+    {Prefix::NONE, 0xEC, -1, Mnemonic::IN},
+    {Prefix::NONE, 0xED, -1, Mnemonic::IN},
+
+    // OUT
+    {Prefix::NONE, 0xE6, -1, Mnemonic::OUT},
+    {Prefix::NONE, 0xE7, -1, Mnemonic::OUT},
+    {Prefix::NONE, 0xEE, -1, Mnemonic::OUT},
+    {Prefix::NONE, 0xEF, -1, Mnemonic::OUT},
+
+    // LOOP
+    {Prefix::NONE, 0xE2, -1, Mnemonic::LOOP},
+    {Prefix::NONE, 0xE1, -1, Mnemonic::LOOPE},
+    {Prefix::NONE, 0xE0, -1, Mnemonic::LOOPNE},
+
+    {Prefix::NONE, 0xE3, -1, Mnemonic::JECXZ},
+    {Prefix::NONE, 0x6C, -1, Mnemonic::INSB},
+    {Prefix::NONE, 0x6D, -1, Mnemonic::INSW},
+    {Prefix::NONE, 0x6E, -1, Mnemonic::OUTSB},
+    {Prefix::NONE, 0x6F, -1, Mnemonic::OUTSW},
+    {Prefix::NONE, 0xAE, -1, Mnemonic::SCASB},
+    {Prefix::NONE, 0xAF, -1, Mnemonic::SCASW},
+    {Prefix::REXW, 0xAF, -1, Mnemonic::SCASQ},
+    {Prefix::NONE, 0xAA, -1, Mnemonic::STOSB},
+    {Prefix::NONE, 0xAB, -1, Mnemonic::STOSW},
+    {Prefix::REXW, 0xAB, -1, Mnemonic::STOSQ},
+    {Prefix::NONE, 0xAC, -1, Mnemonic::LODSB},
+    {Prefix::NONE, 0xAD, -1, Mnemonic::LODSW},
+    {Prefix::REXW, 0xAD, -1, Mnemonic::LODSQ},
+    {Prefix::NONE, 0xA4, -1, Mnemonic::MOVSB},
+    {Prefix::NONE, 0xA5, -1, Mnemonic::MOVSW},
+    {Prefix::REXW, 0xA5, -1, Mnemonic::MOVSQ},
+    {Prefix::NONE, 0xA6, -1, Mnemonic::CMPSB},
+    {Prefix::NONE, 0xA7, -1, Mnemonic::CMPSW},
+    {Prefix::REXW, 0xA7, -1, Mnemonic::CMPSQ},
+    {Prefix::NONE, 0xC9, -1, Mnemonic::LEAVE},
+    {Prefix::NONE, 0x0FA2, -1, Mnemonic::CPUID},
+    {Prefix::NONE, 0xF8, -1, Mnemonic::CLC},
+    {Prefix::NONE, 0xFC, -1, Mnemonic::CLD},
+    {Prefix::NONE, 0xF9, -1, Mnemonic::STC},
+
+    // ADD, ADC, SUB, SBB, AND, OR, XOR, CMP
+    {Prefix::NONE, 0x04, -1, Mnemonic::ADD},
+    {Prefix::NONE, 0x14, -1, Mnemonic::ADC},
+    {Prefix::NONE, 0x2C, -1, Mnemonic::SUB},
+    {Prefix::NONE, 0x1C, -1, Mnemonic::SBB},
+
+    {Prefix::NONE, 0x24, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x0C, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x34, -1, Mnemonic::XOR},
+
+    {Prefix::NONE, 0x3C, -1, Mnemonic::CMP},
+    {Prefix::NONE, 0x3D, -1, Mnemonic::CMP},
+    {Prefix::REXW, 0x3D, -1, Mnemonic::CMP},
+    {Prefix::NONE, 0x38, -1, Mnemonic::CMP},
+    {Prefix::REX, 0x38, -1, Mnemonic::CMP},
+    {Prefix::NONE, 0x39, -1, Mnemonic::CMP},
+    {Prefix::REXW, 0x39, -1, Mnemonic::CMP},
+    {Prefix::NONE, 0x3A, -1, Mnemonic::CMP},
+    {Prefix::REX, 0x3A, -1, Mnemonic::CMP},
+    {Prefix::NONE, 0x3B, -1, Mnemonic::CMP},
+    {Prefix::REXW, 0x3B, -1, Mnemonic::CMP},
+
+    {Prefix::NONE, 0x05, -1, Mnemonic::ADD},
+    {Prefix::REXW, 0x05, -1, Mnemonic::ADD},
+    {Prefix::NONE, 0x15, -1, Mnemonic::ADC},
+    {Prefix::REXW, 0x15, -1, Mnemonic::ADC},
+    {Prefix::NONE, 0x2D, -1, Mnemonic::SUB},
+    {Prefix::REXW, 0x2D, -1, Mnemonic::SUB},
+    {Prefix::NONE, 0x1D, -1, Mnemonic::SBB},
+    {Prefix::REXW, 0x1D, -1, Mnemonic::SBB},
+
+    {Prefix::NONE, 0x25, -1, Mnemonic::AND},
+    {Prefix::REXW, 0x25, -1, Mnemonic::AND},
+    {Prefix::P66, 0x25, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x0D, -1, Mnemonic::OR},
+    {Prefix::REXW, 0x0D, -1, Mnemonic::OR},
+    {Prefix::P66, 0x0D, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x35, -1, Mnemonic::XOR},
+    {Prefix::REXW, 0x35, -1, Mnemonic::XOR},
+    {Prefix::P66, 0x35, -1, Mnemonic::XOR},
+
+    {Prefix::NONE, 0x80, 0, Mnemonic::ADD},
+    {Prefix::NONE, 0x80, 2, Mnemonic::ADC},
+    {Prefix::NONE, 0x80, 5, Mnemonic::SUB},
+    {Prefix::NONE, 0x80, 3, Mnemonic::SBB},
+    {Prefix::NONE, 0x80, 4, Mnemonic::AND},
+    {Prefix::NONE, 0x80, 1, Mnemonic::OR},
+    {Prefix::NONE, 0x80, 6, Mnemonic::XOR},
+    {Prefix::NONE, 0x80, 7, Mnemonic::CMP},
+    {Prefix::REX, 0x80, 0, Mnemonic::ADD},
+    {Prefix::REX, 0x80, 2, Mnemonic::ADC},
+    {Prefix::REX, 0x80, 5, Mnemonic::SUB},
+    {Prefix::REX, 0x80, 3, Mnemonic::SBB},
+    {Prefix::REX, 0x80, 4, Mnemonic::AND},
+    {Prefix::REX, 0x80, 1, Mnemonic::OR},
+    {Prefix::REX, 0x80, 6, Mnemonic::XOR},
+    {Prefix::REX, 0x80, 7, Mnemonic::CMP},
+
+    {Prefix::NONE, 0x81, 0, Mnemonic::ADD},
+    {Prefix::NONE, 0x81, 2, Mnemonic::ADC},
+    {Prefix::NONE, 0x81, 5, Mnemonic::SUB},
+    {Prefix::NONE, 0x81, 3, Mnemonic::SBB},
+    {Prefix::NONE, 0x81, 4, Mnemonic::AND},
+    {Prefix::NONE, 0x81, 1, Mnemonic::OR},
+    {Prefix::NONE, 0x81, 6, Mnemonic::XOR},
+    {Prefix::NONE, 0x81, 7, Mnemonic::CMP},
+    {Prefix::REXW, 0x81, 0, Mnemonic::ADD},
+    {Prefix::REXW, 0x81, 2, Mnemonic::ADC},
+    {Prefix::REXW, 0x81, 5, Mnemonic::SUB},
+    {Prefix::REXW, 0x81, 3, Mnemonic::SBB},
+    {Prefix::REXW, 0x81, 4, Mnemonic::AND},
+    {Prefix::REXW, 0x81, 1, Mnemonic::OR},
+    {Prefix::REXW, 0x81, 6, Mnemonic::XOR},
+    {Prefix::REXW, 0x81, 7, Mnemonic::CMP},
+
+    {Prefix::NONE, 0x83, 0, Mnemonic::ADD},
+    {Prefix::NONE, 0x83, 2, Mnemonic::ADC},
+    {Prefix::NONE, 0x83, 5, Mnemonic::SUB},
+    {Prefix::NONE, 0x83, 3, Mnemonic::SBB},
+    {Prefix::NONE, 0x83, 4, Mnemonic::AND},
+    {Prefix::NONE, 0x83, 1, Mnemonic::OR},
+    {Prefix::NONE, 0x83, 6, Mnemonic::XOR},
+    {Prefix::NONE, 0x83, 7, Mnemonic::CMP},
+    {Prefix::REXW, 0x83, 0, Mnemonic::ADD},
+    {Prefix::REXW, 0x83, 2, Mnemonic::ADC},
+    {Prefix::REXW, 0x83, 5, Mnemonic::SUB},
+    {Prefix::REXW, 0x83, 3, Mnemonic::SBB},
+    {Prefix::REXW, 0x83, 4, Mnemonic::AND},
+    {Prefix::REXW, 0x83, 1, Mnemonic::OR},
+    {Prefix::REXW, 0x83, 6, Mnemonic::XOR},
+    {Prefix::REXW, 0x83, 7, Mnemonic::CMP},
+
+    {Prefix::NONE, 0x00, -1, Mnemonic::ADD},
+    {Prefix::REX, 0x00, -1, Mnemonic::ADD},
+    {Prefix::NONE, 0x10, -1, Mnemonic::ADC},
+    {Prefix::REX, 0x10, -1, Mnemonic::ADC},
+    {Prefix::NONE, 0x28, -1, Mnemonic::SUB},
+    {Prefix::REX, 0x28, -1, Mnemonic::SUB},
+    {Prefix::NONE, 0x18, -1, Mnemonic::SBB},
+    {Prefix::REX, 0x18, -1, Mnemonic::SBB},
+    {Prefix::NONE, 0x20, -1, Mnemonic::AND},
+    {Prefix::REX, 0x20, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x08, -1, Mnemonic::OR},
+    {Prefix::REX, 0x08, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x30, -1, Mnemonic::XOR},
+    {Prefix::REX, 0x30, -1, Mnemonic::XOR},
+
+    {Prefix::NONE, 0x01, -1, Mnemonic::ADD},
+    {Prefix::REXW, 0x01, -1, Mnemonic::ADD},
+    {Prefix::NONE, 0x11, -1, Mnemonic::ADC},
+    {Prefix::REXW, 0x11, -1, Mnemonic::ADC},
+    {Prefix::NONE, 0x29, -1, Mnemonic::SUB},
+    {Prefix::REXW, 0x29, -1, Mnemonic::SUB},
+    {Prefix::NONE, 0x19, -1, Mnemonic::SBB},
+    {Prefix::REXW, 0x19, -1, Mnemonic::SBB},
+
+    {Prefix::NONE, 0x20, -1, Mnemonic::AND},
+    {Prefix::REXW, 0x20, -1, Mnemonic::AND},
+    {Prefix::P66, 0x20, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x08, -1, Mnemonic::OR},
+    {Prefix::REXW, 0x08, -1, Mnemonic::OR},
+    {Prefix::P66, 0x08, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x30, -1, Mnemonic::XOR},
+    {Prefix::REXW, 0x30, -1, Mnemonic::XOR},
+    {Prefix::P66, 0x30, -1, Mnemonic::XOR},
+
+    {Prefix::NONE, 0x02, -1, Mnemonic::ADD},
+    {Prefix::REX, 0x02, -1, Mnemonic::ADD},
+    {Prefix::NONE, 0x12, -1, Mnemonic::ADC},
+    {Prefix::REX, 0x12, -1, Mnemonic::ADC},
+    {Prefix::NONE, 0x2A, -1, Mnemonic::SUB},
+    {Prefix::REX, 0x2A, -1, Mnemonic::SUB},
+    {Prefix::NONE, 0x1A, -1, Mnemonic::SBB},
+    {Prefix::REX, 0x1A, -1, Mnemonic::SBB},
+
+    {Prefix::NONE, 0x21, -1, Mnemonic::AND},
+    {Prefix::REXW, 0x21, -1, Mnemonic::AND},
+    {Prefix::P66, 0x21, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x09, -1, Mnemonic::OR},
+    {Prefix::REXW, 0x09, -1, Mnemonic::OR},
+    {Prefix::P66, 0x09, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x31, -1, Mnemonic::XOR},
+    {Prefix::REXW, 0x31, -1, Mnemonic::XOR},
+    {Prefix::P66, 0x31, -1, Mnemonic::XOR},
+
+    {Prefix::NONE, 0x03, -1, Mnemonic::ADD},
+    {Prefix::REXW, 0x03, -1, Mnemonic::ADD},
+    {Prefix::NONE, 0x13, -1, Mnemonic::ADC},
+    {Prefix::REXW, 0x13, -1, Mnemonic::ADC},
+    {Prefix::NONE, 0x2B, -1, Mnemonic::SUB},
+    {Prefix::REXW, 0x2B, -1, Mnemonic::SUB},
+    {Prefix::NONE, 0x1B, -1, Mnemonic::SBB},
+    {Prefix::REXW, 0x1B, -1, Mnemonic::SBB},
+
+    {Prefix::NONE, 0x22, -1, Mnemonic::AND},
+    {Prefix::REX, 0x22, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x0A, -1, Mnemonic::OR},
+    {Prefix::REX, 0x0A, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x32, -1, Mnemonic::XOR},
+    {Prefix::REX, 0x32, -1, Mnemonic::XOR},
+
+    {Prefix::NONE, 0x23, -1, Mnemonic::AND},
+    {Prefix::REXW, 0x23, -1, Mnemonic::AND},
+    {Prefix::P66, 0x23, -1, Mnemonic::AND},
+    {Prefix::NONE, 0x0B, -1, Mnemonic::OR},
+    {Prefix::REXW, 0x0B, -1, Mnemonic::OR},
+    {Prefix::P66, 0x0B, -1, Mnemonic::OR},
+    {Prefix::NONE, 0x33, -1, Mnemonic::XOR},
+    {Prefix::REXW, 0x33, -1, Mnemonic::XOR},
+    {Prefix::P66, 0x33, -1, Mnemonic::XOR},
+
+    // MOV
+    {Prefix::NONE, 0x88, -1, Mnemonic::MOV},
+    {Prefix::REX, 0x88, -1, Mnemonic::MOV},
+
+    {Prefix::P66, 0x89, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0x89, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0x89, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0x8A, -1, Mnemonic::MOV},
+    {Prefix::REX, 0x8A, -1, Mnemonic::MOV},
+
+    {Prefix::P66, 0x8B, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0x8B, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0x8B, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0x8C, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0x8C, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0x8E, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0x8E, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0xA0, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xA0, -1, Mnemonic::MOV},
+
+    {Prefix::P66, 0xA1, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xA1, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xA1, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0xA2, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xA2, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0xA3, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xA3, -1, Mnemonic::MOV},
+
+    {Prefix::NONE, 0xB0, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB0, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB1, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB1, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB2, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB2, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB3, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB3, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB4, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB4, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB5, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB5, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB6, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB6, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB7, -1, Mnemonic::MOV},
+    {Prefix::REX, 0xB7, -1, Mnemonic::MOV},
+
+    {Prefix::P66, 0xB8, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB8, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xB8, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xB9, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xB9, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xB9, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xBA, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xBA, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xBA, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xBB, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xBB, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xBB, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xBC, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xBC, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xBC, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xBD, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xBD, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xBD, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xBE, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xBE, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xBE, -1, Mnemonic::MOV},
+    {Prefix::P66, 0xBF, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xBF, -1, Mnemonic::MOV},
+    {Prefix::REXW, 0xBF, -1, Mnemonic::MOV},
+    {Prefix::NONE, 0xC6, 0, Mnemonic::MOV},
+    {Prefix::REX, 0xC6, 0, Mnemonic::MOV},
+    {Prefix::P66, 0xC7, 0, Mnemonic::MOV},
+    {Prefix::NONE, 0xC7, 0, Mnemonic::MOV},
+    {Prefix::REXW, 0xC7, 0, Mnemonic::MOV},
+
+    // NEG, NOT, MUL, IMUL, DIV, IDIV, TEST
+    {Prefix::NONE, 0xF6, 3, Mnemonic::NEG},
+    {Prefix::NONE, 0xF6, 2, Mnemonic::NOT},
+    {Prefix::NONE, 0xF6, 4, Mnemonic::MUL},
+    {Prefix::NONE, 0xF6, 5, Mnemonic::IMUL},
+    {Prefix::NONE, 0xF6, 6, Mnemonic::DIV},
+    {Prefix::NONE, 0xF6, 7, Mnemonic::IDIV},
+    {Prefix::NONE, 0xF6, 0, Mnemonic::TEST},
+    {Prefix::REX, 0xF6, 3, Mnemonic::NEG},
+    {Prefix::REX, 0xF6, 2, Mnemonic::NOT},
+    {Prefix::REX, 0xF6, 4, Mnemonic::MUL},
+    {Prefix::REX, 0xF6, 5, Mnemonic::IMUL},
+    {Prefix::REX, 0xF6, 6, Mnemonic::DIV},
+    {Prefix::REX, 0xF6, 7, Mnemonic::IDIV},
+    {Prefix::REX, 0xF6, 0, Mnemonic::TEST},
+
+    {Prefix::P66, 0xF7, 2, Mnemonic::NOT},
+    {Prefix::P66, 0xF7, 4, Mnemonic::MUL},
+    {Prefix::P66, 0xF7, 5, Mnemonic::IMUL},
+    {Prefix::P66, 0xF7, 6, Mnemonic::DIV},
+    {Prefix::P66, 0xF7, 7, Mnemonic::IDIV},
+    {Prefix::P66, 0xF7, 0, Mnemonic::TEST},
+    {Prefix::NONE, 0xF7, 3, Mnemonic::NEG},
+    {Prefix::NONE, 0xF7, 2, Mnemonic::NOT},
+    {Prefix::NONE, 0xF7, 4, Mnemonic::MUL},
+    {Prefix::NONE, 0xF7, 5, Mnemonic::IMUL},
+    {Prefix::NONE, 0xF7, 6, Mnemonic::DIV},
+    {Prefix::NONE, 0xF7, 7, Mnemonic::IDIV},
+    {Prefix::NONE, 0xF7, 0, Mnemonic::TEST},
+    {Prefix::REXW, 0xF7, 3, Mnemonic::NEG},
+    {Prefix::REXW, 0xF7, 2, Mnemonic::NOT},
+    {Prefix::REXW, 0xF7, 4, Mnemonic::MUL},
+    {Prefix::REXW, 0xF7, 5, Mnemonic::IMUL},
+    {Prefix::REXW, 0xF7, 6, Mnemonic::DIV},
+    {Prefix::REXW, 0xF7, 7, Mnemonic::IDIV},
+    {Prefix::REXW, 0xF7, 0, Mnemonic::TEST},
+
+    {Prefix::NONE, 0x84, -1, Mnemonic::TEST},
+    {Prefix::REX, 0x84, -1, Mnemonic::TEST},
+    {Prefix::NONE, 0x85, -1, Mnemonic::TEST},
+    {Prefix::REXW, 0x85, -1, Mnemonic::TEST},
+
+    {Prefix::P66, 0x0FAF, -1, Mnemonic::IMUL},
+    {Prefix::NONE, 0x0FAF, -1, Mnemonic::IMUL},
+    {Prefix::REXW, 0x0FAF, -1, Mnemonic::IMUL},
+
+    {Prefix::P66, 0x6B, -1, Mnemonic::IMUL},
+    {Prefix::NONE, 0x6B, -1, Mnemonic::IMUL},
+    {Prefix::REXW, 0x6B, -1, Mnemonic::IMUL},
+
+    {Prefix::P66, 0x69, -1, Mnemonic::IMUL},
+    {Prefix::NONE, 0x69, -1, Mnemonic::IMUL},
+    {Prefix::REXW, 0x69, -1, Mnemonic::IMUL},
+
+    {Prefix::NONE, 0xA8, -1, Mnemonic::TEST},
+    {Prefix::P66, 0xA9, -1, Mnemonic::TEST},
+    {Prefix::NONE, 0xA9, -1, Mnemonic::TEST},
+    {Prefix::REXW, 0xA9, -1, Mnemonic::TEST},
+
+    // INC, DEC
+    {Prefix::NONE, 0xFE, 0, Mnemonic::INC},
+    {Prefix::NONE, 0xFE, 1, Mnemonic::DEC},
+    {Prefix::REX, 0xFE, 0, Mnemonic::INC},
+    {Prefix::REX, 0xFE, 1, Mnemonic::DEC},
+    {Prefix::REXW, 0xFE, 0, Mnemonic::INC},
+    {Prefix::REXW, 0xFE, 1, Mnemonic::DEC},
+
+    // CBW, CWDE, CDQE
+    {Prefix::P66, 0x98, -1, Mnemonic::CBW},
+    {Prefix::NONE, 0x98, -1, Mnemonic::CWDE},
+    {Prefix::REXW, 0x98, -1, Mnemonic::CDQE},
+
+    // CWD, CDQ, CQO
+    {Prefix::P66, 0x98, -1, Mnemonic::CWD},
+    {Prefix::NONE, 0x98, -1, Mnemonic::CDQ},
+    {Prefix::REXW, 0x98, -1, Mnemonic::CQO},
+
+    // MOVSX
+    {Prefix::P66, 0x0FBE, -1, Mnemonic::MOVSX},
+    {Prefix::NONE, 0x0FBE, -1, Mnemonic::MOVSX},
+    {Prefix::REX, 0x0FBE, -1, Mnemonic::MOVSX},
+    {Prefix::NONE, 0x0FBF, -1, Mnemonic::MOVSX},
+    {Prefix::REXW, 0x0FBF, -1, Mnemonic::MOVSX},
+
+    // MOVSXD
+    {Prefix::REXW, 0x63, -1, Mnemonic::MOVSXD},
+
+    // MOVZX
+    {Prefix::P66, 0x0FB6, -1, Mnemonic::MOVZX},
+    {Prefix::NONE, 0x0FB6, -1, Mnemonic::MOVZX},
+    {Prefix::REX, 0x0FB6, -1, Mnemonic::MOVZX},
+    {Prefix::NONE, 0x0FB7, -1, Mnemonic::MOVZX},
+    {Prefix::REXW, 0x0FB7, -1, Mnemonic::MOVZX},
+
+    // LEA
+    {Prefix::P66, 0x8D, -1, Mnemonic::LEA},
+    {Prefix::NONE, 0x8D, -1, Mnemonic::LEA},
+    {Prefix::REXW, 0x8D, -1, Mnemonic::LEA},
+
+    // NOP
+    {Prefix::NONE, 0x90, -1, Mnemonic::NOP},
+    {Prefix::NONE, 0x0F1F, 0, Mnemonic::NOP},
+    {Prefix::P66, 0x90, -1, Mnemonic::NOP},
+    {Prefix::P66, 0x0F1F, 0, Mnemonic::NOP},
+
+    // RET
+    {Prefix::NONE, 0xC3, -1, Mnemonic::RET},
+    {Prefix::NONE, 0xCB, -1, Mnemonic::RET},
+    {Prefix::NONE, 0xC2, -1, Mnemonic::RET},
+    {Prefix::NONE, 0xCA, -1, Mnemonic::RET},
+
+    {Prefix::NONE, 0xFF, 0, Mnemonic::INC},
+    {Prefix::NONE, 0xFF, 1, Mnemonic::DEC},
+    {Prefix::NONE, 0xFF, 2, Mnemonic::CALL},
+    {Prefix::NONE, 0xFF, 4, Mnemonic::JMP},
+    {Prefix::NONE, 0xFF, 5, Mnemonic::JMP},
+    {Prefix::NONE, 0xFF, 6, Mnemonic::PUSH},
+
+    // CALL
+    {Prefix::NONE, 0xE8, -1, Mnemonic::CALL},
+    {Prefix::NONE, 0x9A, -1, Mnemonic::CALL},
+
+    // JCC
+    {Prefix::NONE, 0x0F80, -1, Mnemonic::JO},
+    {Prefix::NONE, 0x0F81, -1, Mnemonic::JNO},
+    {Prefix::NONE, 0x0F82, -1, Mnemonic::JNAE},
+    {Prefix::NONE, 0x0F83, -1, Mnemonic::JNB},
+    {Prefix::NONE, 0x0F84, -1, Mnemonic::JZ},
+    {Prefix::NONE, 0x0F85, -1, Mnemonic::JNZ},
+    {Prefix::NONE, 0x0F86, -1, Mnemonic::JNA},
+    {Prefix::NONE, 0x0F87, -1, Mnemonic::JNBE},
+    {Prefix::NONE, 0x0F88, -1, Mnemonic::JS},
+    {Prefix::NONE, 0x0F89, -1, Mnemonic::JNS},
+    {Prefix::NONE, 0x0F8A, -1, Mnemonic::JP},
+    {Prefix::NONE, 0x0F8B, -1, Mnemonic::JPO},
+    {Prefix::NONE, 0x0F8C, -1, Mnemonic::JNGE},
+    {Prefix::NONE, 0x0F8D, -1, Mnemonic::JNL},
+    {Prefix::NONE, 0x0F8E, -1, Mnemonic::JNG},
+    {Prefix::NONE, 0x0F8F, -1, Mnemonic::JNLE},
+
+    {Prefix::NONE, 0x70, -1, Mnemonic::JO},
+    {Prefix::NONE, 0x71, -1, Mnemonic::JNO},
+    {Prefix::NONE, 0x72, -1, Mnemonic::JNAE},
+    {Prefix::NONE, 0x73, -1, Mnemonic::JNB},
+    {Prefix::NONE, 0x74, -1, Mnemonic::JZ},
+    {Prefix::NONE, 0x75, -1, Mnemonic::JNZ},
+    {Prefix::NONE, 0x76, -1, Mnemonic::JNA},
+    {Prefix::NONE, 0x77, -1, Mnemonic::JNBE},
+    {Prefix::NONE, 0x78, -1, Mnemonic::JS},
+    {Prefix::NONE, 0x79, -1, Mnemonic::JNS},
+    {Prefix::NONE, 0x7A, -1, Mnemonic::JP},
+    {Prefix::NONE, 0x7B, -1, Mnemonic::JPO},
+    {Prefix::NONE, 0x7C, -1, Mnemonic::JNGE},
+    {Prefix::NONE, 0x7D, -1, Mnemonic::JNL},
+    {Prefix::NONE, 0x7E, -1, Mnemonic::JNG},
+    {Prefix::NONE, 0x7F, -1, Mnemonic::JNLE},
+
+    // JMP
+    {Prefix::NONE, 0xEB, -1, Mnemonic::JMP},
+    {Prefix::NONE, 0xE9, -1, Mnemonic::JMP},
+
+    // BSWAP
+    {Prefix::NONE, 0x0FC8, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FC8, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FC9, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FC9, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FCA, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FCA, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FCB, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FCB, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FCC, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FCC, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FCD, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FCD, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FCE, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FCE, -1, Mnemonic::BSWAP},
+    {Prefix::NONE, 0x0FCF, -1, Mnemonic::BSWAP},
+    {Prefix::REXW, 0x0FCF, -1, Mnemonic::BSWAP},
+
+    // SAL
+    {Prefix::NONE, 0xD0, 4, Mnemonic::SAL},
+    {Prefix::NONE, 0xD0, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xD0, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xD0, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xD0, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xD0, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xD0, 1, Mnemonic::ROR},
+    {Prefix::NONE, 0xD0, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xD0, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xD0, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xD0, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xD0, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xD0, 1, Mnemonic::ROR},
+    {Prefix::REX, 0xD0, 4, Mnemonic::SAL},
+    {Prefix::REX, 0xD0, 7, Mnemonic::SAR},
+    {Prefix::REX, 0xD0, 5, Mnemonic::SHR},
+    {Prefix::REX, 0xD0, 2, Mnemonic::RCL},
+    {Prefix::REX, 0xD0, 3, Mnemonic::RCR},
+    {Prefix::REX, 0xD0, 0, Mnemonic::ROL},
+    {Prefix::REX, 0xD0, 1, Mnemonic::ROR},
+
+    {Prefix::NONE, 0xD2, 4, Mnemonic::SAL},
+    {Prefix::NONE, 0xD2, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xD2, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xD2, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xD2, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xD2, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xD2, 1, Mnemonic::ROR},
+    {Prefix::REX, 0xD2, 4, Mnemonic::SAL},
+    {Prefix::REX, 0xD2, 7, Mnemonic::SAR},
+    {Prefix::REX, 0xD2, 5, Mnemonic::SHR},
+    {Prefix::REX, 0xD2, 2, Mnemonic::RCL},
+    {Prefix::REX, 0xD2, 3, Mnemonic::RCR},
+    {Prefix::REX, 0xD2, 0, Mnemonic::ROL},
+    {Prefix::REX, 0xD2, 1, Mnemonic::ROR},
+
+    {Prefix::NONE, 0xC0, 4, Mnemonic::SAL},
+    {Prefix::NONE, 0xC0, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xC0, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xC0, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xC0, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xC0, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xC0, 1, Mnemonic::ROR},
+    {Prefix::REX, 0xC0, 4, Mnemonic::SAL},
+    {Prefix::REX, 0xC0, 7, Mnemonic::SAR},
+    {Prefix::REX, 0xC0, 5, Mnemonic::SHR},
+    {Prefix::REX, 0xC0, 2, Mnemonic::RCL},
+    {Prefix::REX, 0xC0, 3, Mnemonic::RCR},
+    {Prefix::REX, 0xC0, 0, Mnemonic::ROL},
+    {Prefix::REX, 0xC0, 1, Mnemonic::ROR},
+
+    {Prefix::P66, 0xD1, 4, Mnemonic::SAL},
+    {Prefix::P66, 0xD1, 7, Mnemonic::SAR},
+    {Prefix::P66, 0xD1, 5, Mnemonic::SHR},
+    {Prefix::P66, 0xD1, 2, Mnemonic::RCL},
+    {Prefix::P66, 0xD1, 3, Mnemonic::RCR},
+    {Prefix::P66, 0xD1, 0, Mnemonic::ROL},
+    {Prefix::P66, 0xD1, 1, Mnemonic::ROR},
+    {Prefix::NONE, 0xD1, 4, Mnemonic::SAL},
+    {Prefix::NONE, 0xD1, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xD1, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xD1, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xD1, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xD1, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xD1, 1, Mnemonic::ROR},
+    {Prefix::REXW, 0xD1, 4, Mnemonic::SAL},
+    {Prefix::REXW, 0xD1, 7, Mnemonic::SAR},
+    {Prefix::REXW, 0xD1, 5, Mnemonic::SHR},
+    {Prefix::REXW, 0xD1, 2, Mnemonic::RCL},
+    {Prefix::REXW, 0xD1, 3, Mnemonic::RCR},
+    {Prefix::REXW, 0xD1, 0, Mnemonic::ROL},
+    {Prefix::REXW, 0xD1, 1, Mnemonic::ROR},
+
+    {Prefix::P66, 0xD3, 4, Mnemonic::SAL},
+    {Prefix::P66, 0xD3, 7, Mnemonic::SAR},
+    {Prefix::P66, 0xD3, 5, Mnemonic::SHR},
+    {Prefix::P66, 0xD3, 2, Mnemonic::RCL},
+    {Prefix::P66, 0xD3, 3, Mnemonic::RCR},
+    {Prefix::P66, 0xD3, 0, Mnemonic::ROL},
+    {Prefix::P66, 0xD3, 1, Mnemonic::ROR},
+    {Prefix::NONE, 0xD3, 4, Mnemonic::SAL},
+    {Prefix::NONE, 0xD3, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xD3, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xD3, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xD3, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xD3, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xD3, 1, Mnemonic::ROR},
+    {Prefix::REXW, 0xD3, 4, Mnemonic::SAL},
+    {Prefix::REXW, 0xD3, 7, Mnemonic::SAR},
+    {Prefix::REXW, 0xD3, 5, Mnemonic::SHR},
+    {Prefix::REXW, 0xD3, 2, Mnemonic::RCL},
+    {Prefix::REXW, 0xD3, 3, Mnemonic::RCR},
+    {Prefix::REXW, 0xD3, 0, Mnemonic::ROL},
+    {Prefix::REXW, 0xD3, 1, Mnemonic::ROR},
+
+    {Prefix::P66, 0xC1, 4, Mnemonic::SAL},
+    {Prefix::P66, 0xC1, 7, Mnemonic::SAR},
+    {Prefix::P66, 0xC1, 5, Mnemonic::SHR},
+    {Prefix::P66, 0xC1, 2, Mnemonic::RCL},
+    {Prefix::P66, 0xC1, 3, Mnemonic::RCR},
+    {Prefix::P66, 0xC1, 0, Mnemonic::ROL},
+    {Prefix::P66, 0xC1, 1, Mnemonic::ROR},
+    {Prefix::NONE, 0xC1, 4, Mnemonic::SAL},
+    {Prefix::NONE, 0xC1, 7, Mnemonic::SAR},
+    {Prefix::NONE, 0xC1, 5, Mnemonic::SHR},
+    {Prefix::NONE, 0xC1, 2, Mnemonic::RCL},
+    {Prefix::NONE, 0xC1, 3, Mnemonic::RCR},
+    {Prefix::NONE, 0xC1, 0, Mnemonic::ROL},
+    {Prefix::NONE, 0xC1, 1, Mnemonic::ROR},
+    {Prefix::REXW, 0xC1, 4, Mnemonic::SAL},
+    {Prefix::REXW, 0xC1, 7, Mnemonic::SAR},
+    {Prefix::REXW, 0xC1, 5, Mnemonic::SHR},
+    {Prefix::REXW, 0xC1, 2, Mnemonic::RCL},
+    {Prefix::REXW, 0xC1, 3, Mnemonic::RCR},
+    {Prefix::REXW, 0xC1, 0, Mnemonic::ROL},
+    {Prefix::REXW, 0xC1, 1, Mnemonic::ROR},
+
+    {Prefix::P66, 0x0FA4, -1, Mnemonic::SHLD},
+    {Prefix::NONE, 0x0FA4, -1, Mnemonic::SHLD},
+    {Prefix::REXW, 0x0FA4, -1, Mnemonic::SHLD},
+    {Prefix::P66, 0x0FA5, -1, Mnemonic::SHLD},
+    {Prefix::NONE, 0x0FA5, -1, Mnemonic::SHLD},
+    {Prefix::REXW, 0x0FA5, -1, Mnemonic::SHLD},
+
+    {Prefix::P66, 0x0FAC, -1, Mnemonic::SHRD},
+    {Prefix::NONE, 0x0FAC, -1, Mnemonic::SHRD},
+    {Prefix::REXW, 0x0FAC, -1, Mnemonic::SHRD},
+    {Prefix::P66, 0x0FAD, -1, Mnemonic::SHRD},
+    {Prefix::NONE, 0x0FAD, -1, Mnemonic::SHRD},
+    {Prefix::REXW, 0x0FAD, -1, Mnemonic::SHRD},
+
+    // POP
+    {Prefix::NONE, 0x8F, 0, Mnemonic::POP},
+    {Prefix::NONE, 0x58, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x59, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x5A, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x5B, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x5C, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x5D, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x5E, -1, Mnemonic::POP},
+    {Prefix::NONE, 0x5F, -1, Mnemonic::POP},
+
+    // PUSH
+    {Prefix::NONE, 0x50, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x51, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x52, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x53, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x54, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x55, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x56, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x57, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x6A, -1, Mnemonic::PUSH},
+    {Prefix::NONE, 0x68, -1, Mnemonic::PUSH},
 };
 
 // Lookup table for operand information
-// (prefix, operator, opcode) -> (encoding, remaining opcodes, operands)
-const std::unordered_map<
-    std::tuple<Prefix, Mnemonic, int>,
-    std::tuple<OpEnc, std::vector<std::string>, std::vector<Operand>>>
-    OPERAND_LOOKUP = {
-        // SETNE
-        {{Prefix::NONE, Mnemonic::SETNE, u2d("\x0F\x95")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::SETNE, u2d("\x0F\x95")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8")},
-         {OpEnc::M, {"0"}, {Operand::m32fp}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC")},
-         {OpEnc::M, {"0"}, {Operand::m64fp}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC0")},
-         {OpEnc::NP, {"0"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC1")},
-         {OpEnc::NP, {"1"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC2")},
-         {OpEnc::NP, {"2"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC3")},
-         {OpEnc::NP, {"3"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC4")},
-         {OpEnc::NP, {"4"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC5")},
-         {OpEnc::NP, {"5"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC6")},
-         {OpEnc::NP, {"6"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xD8\xC7")},
-         {OpEnc::NP, {"7"}, {Operand::st0, Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC0")},
-         {OpEnc::NP, {"0"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC1")},
-         {OpEnc::NP, {"1"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC2")},
-         {OpEnc::NP, {"2"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC3")},
-         {OpEnc::NP, {"3"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC4")},
-         {OpEnc::NP, {"4"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC5")},
-         {OpEnc::NP, {"5"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC6")},
-         {OpEnc::NP, {"6"}, {Operand::sti, Operand::st0}}},
-        {{Prefix::NONE, Mnemonic::FADD, u2d("\xDC\xC7")},
-         {OpEnc::NP, {"7"}, {Operand::sti, Operand::st0}}},
-
-        // FXCH
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xC8")},
-         {OpEnc::NP, {"0"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xC9")},
-         {OpEnc::NP, {"1"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xCA")},
-         {OpEnc::NP, {"2"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xCB")},
-         {OpEnc::NP, {"3"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xCC")},
-         {OpEnc::NP, {"4"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xCD")},
-         {OpEnc::NP, {"5"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xCE")},
-         {OpEnc::NP, {"6"}, {Operand::sti}}},
-        {{Prefix::NONE, Mnemonic::FXCH, u2d("\xD9\xCF")},
-         {OpEnc::NP, {"7"}, {Operand::sti}}},
-
-        // CMOVE
-        {{Prefix::NONE, Mnemonic::CMOVE, u2d("\x0F\x44")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-
-        // MOVAPS
-        {{Prefix::NONE, Mnemonic::MOVAPS, u2d("\x0F\x28")},
-         {OpEnc::A, {"/r"}, {Operand::xmm, Operand::xm128}}},
-        {{Prefix::NONE, Mnemonic::MOVAPS, u2d("\x0F\x29")},
-         {OpEnc::B, {"/r"}, {Operand::xm128, Operand::xmm}}},
-
-        // ENDBR
-        {{Prefix::NONE, Mnemonic::ENDBR64, u2d("\xF3\x0F\x1E\xFA")},
-         {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::ENDBR32, u2d("\xF3\x0F\x1E\xFB")},
-         {OpEnc::NP, {}, {}}},
-
-        // IN
-        {{Prefix::NONE, Mnemonic::IN, u2d("\xE4")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::IN, u2d("\xE5")},
-         {OpEnc::I, {"ib"}, {Operand::eax, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::IN, u2d("\xEC")},
-         {OpEnc::NP, {}, {Operand::al, Operand::dx}}},
-        {{Prefix::NONE, Mnemonic::IN, u2d("\xED")},
-         {OpEnc::NP, {}, {Operand::eax, Operand::dx}}},
-
-        // OUT
-        {{Prefix::NONE, Mnemonic::OUT, u2d("\xE6")},
-         {OpEnc::I, {"ib"}, {Operand::imm8, Operand::al}}},
-        {{Prefix::NONE, Mnemonic::OUT, u2d("\xE7")},
-         {OpEnc::I, {"ib"}, {Operand::imm8, Operand::eax}}},
-        {{Prefix::NONE, Mnemonic::OUT, u2d("\xEE")},
-         {OpEnc::NP, {}, {Operand::dx, Operand::al}}},
-        {{Prefix::NONE, Mnemonic::OUT, u2d("\xEF")},
-         {OpEnc::NP, {}, {Operand::dx, Operand::eax}}},
-
-        // LOOP
-        {{Prefix::NONE, Mnemonic::LOOP, u2d("\xE2")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::LOOPE, u2d("\xE1")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::LOOPNE, u2d("\xE0")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-
-        // SHLD
-        {{Prefix::NONE, Mnemonic::SHLD, u2d("\x0F\xA4")},
-         {OpEnc::MRI, {"ib"}, {Operand::rm32, Operand::reg32, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SHLD, u2d("\x0F\xA5")},
-         {OpEnc::MRC, {"/r"}, {Operand::rm32, Operand::reg32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::SHLD, u2d("\x0F\xA4")},
-         {OpEnc::MRI, {"ib"}, {Operand::rm64, Operand::reg64, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SHLD, u2d("\x0F\xA5")},
-         {OpEnc::MRC, {"/r"}, {Operand::rm64, Operand::reg64, Operand::cl}}},
-
-        // SHRD
-        {{Prefix::NONE, Mnemonic::SHRD, u2d("\x0F\xAC")},
-         {OpEnc::MRI, {"ib"}, {Operand::rm32, Operand::reg32, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SHRD, u2d("\x0F\xAD")},
-         {OpEnc::MRC, {"/r"}, {Operand::rm32, Operand::reg32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::SHRD, u2d("\x0F\xAC")},
-         {OpEnc::MRI, {"ib"}, {Operand::rm64, Operand::reg64, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SHRD, u2d("\x0F\xAD")},
-         {OpEnc::MRC, {"/r"}, {Operand::rm64, Operand::reg64, Operand::cl}}},
-
-        {{Prefix::NONE, Mnemonic::JECXZ, u2d("\xE3")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::INSB, u2d("\x6C")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::INSW, u2d("\x6D")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::OUTSB, u2d("\x6E")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::OUTSW, u2d("\x6F")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::STOSB, u2d("\xAA")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::STOSW, u2d("\xAB")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::REXW, Mnemonic::STOSQ, u2d("\xAB")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::SCASB, u2d("\xAE")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::SCASW, u2d("\xAF")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::REXW, Mnemonic::SCASQ, u2d("\xAF")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::LODSB, u2d("\xAC")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::LODSW, u2d("\xAD")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::REXW, Mnemonic::LODSQ, u2d("\xAD")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::MOVSB, u2d("\xA4")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::MOVSW, u2d("\xA5")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::REXW, Mnemonic::MOVSQ, u2d("\xA5")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::CMPSB, u2d("\xA6")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::CMPSW, u2d("\xA7")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::REXW, Mnemonic::CMPSQ, u2d("\xA7")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::CPUID, u2d("\x0F\xA2")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::LEAVE, u2d("\xC9")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::CLC, u2d("\xF8")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::CLD, u2d("\xFC")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::STC, u2d("\xF9")}, {OpEnc::NP, {}, {}}},
-        // ADD
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x04")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x05")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::ADD, u2d("\x05")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::ADD, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::ADD, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::ADD, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x00")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x01")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::ADD, u2d("\x01")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x02")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::ADD, u2d("\x02")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::ADD, u2d("\x03")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::ADD, u2d("\x03")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // ADC
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x14")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x15")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::ADC, u2d("\x15")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::ADC, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::ADC, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::ADC, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x10")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::ADC, u2d("\x10")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x11")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::ADC, u2d("\x11")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x12")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::ADC, u2d("\x12")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::ADC, u2d("\x13")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::ADC, u2d("\x13")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // SUB
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x2C")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x2D")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::SUB, u2d("\x2D")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::SUB, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::SUB, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SUB, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x29")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::SUB, u2d("\x29")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x2A")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::SUB, u2d("\x2A")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x2B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::SUB, u2d("\x2B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-        {{Prefix::NONE, Mnemonic::SUB, u2d("\x28")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::SUB, u2d("\x28")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-
-        // SBB
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x1C")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x1D")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::SBB, u2d("\x1D")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::SBB, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::SBB, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SBB, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x19")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::SBB, u2d("\x19")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x1A")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::SBB, u2d("\x1A")},
-         {OpEnc::RM, {"ib"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::SBB, u2d("\x1B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::SBB, u2d("\x1B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // INC
-        {{Prefix::NONE, Mnemonic::INC, u2d("\xFE")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::INC, u2d("\xFE")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::INC, u2d("\xFF")},
-         {OpEnc::M, {}, {Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::INC, u2d("\xFF")},
-         {OpEnc::M, {}, {Operand::rm64}}},
-
-        // DEC
-        {{Prefix::NONE, Mnemonic::DEC, u2d("\xFE")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::DEC, u2d("\xFE")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::DEC, u2d("\xFF")},
-         {OpEnc::M, {}, {Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::DEC, u2d("\xFF")},
-         {OpEnc::M, {}, {Operand::rm64}}},
-
-        // NEG
-        {{Prefix::NONE, Mnemonic::NEG, u2d("\xF6")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::NEG, u2d("\xF6")},
-         {OpEnc::M, {}, {Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::NEG, u2d("\xF7")},
-         {OpEnc::M, {}, {Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::NEG, u2d("\xF7")},
-         {OpEnc::M, {}, {Operand::rm64}}},
-
-        // AND
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x24")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::AND, u2d("\x25")},
-         {OpEnc::I, {"iw"}, {Operand::ax, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x25")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::AND, u2d("\x25")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::AND, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::AND, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::AND, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm64, Operand::imm32}}},
-        {{Prefix::P66, Mnemonic::AND, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::AND, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x20")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::AND, u2d("\x20")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x22")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::AND, u2d("\x22")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::P66, Mnemonic::AND, u2d("\x21")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x21")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::AND, u2d("\x21")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::P66, Mnemonic::AND, u2d("\x23")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::AND, u2d("\x23")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::AND, u2d("\x23")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // OR
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x0C")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::OR, u2d("\x0D")},
-         {OpEnc::I, {"iw"}, {Operand::ax, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x0D")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::OR, u2d("\x0D")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::OR, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::OR, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::OR, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm64, Operand::imm32}}},
-        {{Prefix::P66, Mnemonic::OR, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::OR, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::OR, u2d("\x09")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x08")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::OR, u2d("\x08")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x09")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::OR, u2d("\x09")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::P66, Mnemonic::OR, u2d("\x0B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::OR, u2d("\x0B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::OR, u2d("\x0B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // XOR
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x30")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::XOR, u2d("\x30")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x34")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::XOR, u2d("\x35")},
-         {OpEnc::I, {"iw"}, {Operand::ax, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x35")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::XOR, u2d("\x35")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::P66, Mnemonic::XOR, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::XOR, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::P66, Mnemonic::XOR, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::XOR, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::XOR, u2d("\x31")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x31")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::XOR, u2d("\x31")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::P66, Mnemonic::XOR, u2d("\x33")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::XOR, u2d("\x33")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::XOR, u2d("\x33")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // NOT
-        {{Prefix::NONE, Mnemonic::NOT, u2d("\xF6")},
-         {OpEnc::RM, {}, {Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::NOT, u2d("\xF6")},
-         {OpEnc::RM, {}, {Operand::reg8}}},
-        {{Prefix::P66, Mnemonic::NOT, u2d("\xF7")},
-         {OpEnc::RM, {}, {Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::NOT, u2d("\xF7")},
-         {OpEnc::RM, {}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::NOT, u2d("\xF7")},
-         {OpEnc::RM, {}, {Operand::reg64}}},
-
-        // MUL
-        {{Prefix::NONE, Mnemonic::MUL, u2d("\xF6")},
-         {OpEnc::RM, {}, {Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::MUL, u2d("\xF6")},
-         {OpEnc::RM, {}, {Operand::reg8}}},
-        {{Prefix::P66, Mnemonic::MUL, u2d("\xF7")},
-         {OpEnc::RM, {}, {Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::MUL, u2d("\xF7")},
-         {OpEnc::RM, {}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::MUL, u2d("\xF7")},
-         {OpEnc::RM, {}, {Operand::reg64}}},
-
-        // IMUL
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\xF6")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::IMUL, u2d("\xF6")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8}}},
-        {{Prefix::P66, Mnemonic::IMUL, u2d("\xF7")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\xF7")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::IMUL, u2d("\xF7")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64}}},
-        {{Prefix::P66, Mnemonic::IMUL, u2d("\x0F\xAF")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\x0F\xAF")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::IMUL, u2d("\x0F\xAF")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-        {{Prefix::P66, Mnemonic::IMUL, u2d("\x6B")},
-         {OpEnc::RMI, {"ib"}, {Operand::reg16, Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\x6B")},
-         {OpEnc::RMI, {"ib"}, {Operand::reg32, Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::IMUL, u2d("\x6B")},
-         {OpEnc::RMI, {"ib"}, {Operand::reg64, Operand::rm64, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::IMUL, u2d("\x6B")},
-         {OpEnc::RMI, {"ib"}, {Operand::reg16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\x6B")},
-         {OpEnc::RMI, {"ib"}, {Operand::reg32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::IMUL, u2d("\x6B")},
-         {OpEnc::RMI, {"ib"}, {Operand::reg64, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::IMUL, u2d("\x69")},
-         {OpEnc::RMI, {"iw"}, {Operand::reg16, Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\x69")},
-         {OpEnc::RMI, {"id"}, {Operand::reg32, Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::IMUL, u2d("\x69")},
-         {OpEnc::RMI, {"id"}, {Operand::reg64, Operand::rm64, Operand::imm32}}},
-        {{Prefix::P66, Mnemonic::IMUL, u2d("\x69")},
-         {OpEnc::RMI, {"iw"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::IMUL, u2d("\x69")},
-         {OpEnc::RMI, {"id"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::IMUL, u2d("\x69")},
-         {OpEnc::RMI, {"id"}, {Operand::reg64, Operand::imm32}}},
-
-        // DIV
-        {{Prefix::NONE, Mnemonic::DIV, u2d("\xF6")},
-         {OpEnc::M, {"/r"}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::DIV, u2d("\xF6")},
-         {OpEnc::M, {"/r"}, {Operand::rm8}}},
-        {{Prefix::P66, Mnemonic::DIV, u2d("\xF7")},
-         {OpEnc::M, {"/r"}, {Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::DIV, u2d("\xF7")},
-         {OpEnc::M, {"/r"}, {Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::DIV, u2d("\xF7")},
-         {OpEnc::M, {"/r"}, {Operand::rm64}}},
-
-        // IDIV
-        {{Prefix::NONE, Mnemonic::IDIV, u2d("\xF6")},
-         {OpEnc::M, {"/r"}, {Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::IDIV, u2d("\xF6")},
-         {OpEnc::M, {"/r"}, {Operand::rm8}}},
-        {{Prefix::P66, Mnemonic::IDIV, u2d("\xF7")},
-         {OpEnc::M, {"/r"}, {Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::IDIV, u2d("\xF7")},
-         {OpEnc::M, {"/r"}, {Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::IDIV, u2d("\xF7")},
-         {OpEnc::M, {"/r"}, {Operand::rm64}}},
-
-        // CMP
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x3C")},
-         {OpEnc::I, {"id"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::CMP, u2d("\x3D")},
-         {OpEnc::I, {"id"}, {Operand::ax, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x3D")},
-         {OpEnc::I, {"id"}, {Operand::eax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::CMP, u2d("\x3D")},
-         {OpEnc::I, {"id"}, {Operand::rax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::CMP, u2d("\x80")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::CMP, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::CMP, u2d("\x81")},
-         {OpEnc::MI, {"id"}, {Operand::rm64, Operand::imm32}}},
-        {{Prefix::P66, Mnemonic::CMP, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::CMP, u2d("\x83")},
-         {OpEnc::MI, {"ib"}, {Operand::rm64, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x38")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::CMP, u2d("\x38")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::P66, Mnemonic::CMP, u2d("\x39")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x39")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::CMP, u2d("\x39")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::P66, Mnemonic::CMP, u2d("\x3B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x3A")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::CMP, u2d("\x3A")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::CMP, u2d("\x3B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::CMP, u2d("\x3B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // TEST
-        {{Prefix::NONE, Mnemonic::TEST, u2d("\xA8")},
-         {OpEnc::I, {"ib"}, {Operand::al, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::TEST, u2d("\xA9")},
-         {OpEnc::I, {"iw"}, {Operand::ax, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::TEST, u2d("\xA9")},
-         {OpEnc::I, {"id"}, {Operand::ax, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::TEST, u2d("\xA9")},
-         {OpEnc::I, {"id"}, {Operand::ax, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::TEST, u2d("\xF6")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::TEST, u2d("\xF6")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::TEST, u2d("\xF7")},
-         {OpEnc::MI, {"iw"}, {Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::TEST, u2d("\xF7")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::TEST, u2d("\xF7")},
-         {OpEnc::MI, {"id"}, {Operand::rm64, Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::TEST, u2d("\x84")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::TEST, u2d("\x84")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::P66, Mnemonic::TEST, u2d("\x85")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::TEST, u2d("\x85")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::TEST, u2d("\x85")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-
-        // MOV
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\x88")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\x88")},
-         {OpEnc::MR, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\x89")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\x89")},
-         {OpEnc::MR, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\x89")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\x8A")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\x8A")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\x8B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\x8B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\x8B")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\x8C")},
-         {OpEnc::MR, {"/r"}, {Operand::rm16, Operand::sreg}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\x8C")},
-         {OpEnc::MR, {"/r"}, {Operand::rm64, Operand::sreg}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\x8E")},
-         {OpEnc::RM, {"/r"}, {Operand::sreg, Operand::rm16}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\x8E")},
-         {OpEnc::RM, {"/r"}, {Operand::sreg, Operand::rm64}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xA0")},
-         {OpEnc::FD, {}, {Operand::al, Operand::moffs8}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xA0")},
-         {OpEnc::FD, {}, {Operand::al, Operand::moffs8}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xA1")},
-         {OpEnc::FD, {}, {Operand::ax, Operand::moffs16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xA1")},
-         {OpEnc::FD, {}, {Operand::eax, Operand::moffs32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xA1")},
-         {OpEnc::FD, {}, {Operand::rax, Operand::moffs64}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xA2")},
-         {OpEnc::TD, {}, {Operand::moffs8, Operand::al}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xA2")},
-         {OpEnc::TD, {}, {Operand::moffs8, Operand::al}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xA3")},
-         {OpEnc::TD, {}, {Operand::moffs16, Operand::ax}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xA3")},
-         {OpEnc::TD, {}, {Operand::moffs64, Operand::rax}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB0")},
-         {OpEnc::OI, {"0"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB0")},
-         {OpEnc::OI, {"0"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB1")},
-         {OpEnc::OI, {"1"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB1")},
-         {OpEnc::OI, {"1"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB2")},
-         {OpEnc::OI, {"2"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB2")},
-         {OpEnc::OI, {"2"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB3")},
-         {OpEnc::OI, {"3"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB3")},
-         {OpEnc::OI, {"3"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB4")},
-         {OpEnc::OI, {"4"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB4")},
-         {OpEnc::OI, {"4"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB5")},
-         {OpEnc::OI, {"5"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB5")},
-         {OpEnc::OI, {"5"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB6")},
-         {OpEnc::OI, {"6"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB6")},
-         {OpEnc::OI, {"6"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB7")},
-         {OpEnc::OI, {"7"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xB7")},
-         {OpEnc::OI, {"7"}, {Operand::reg8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xB8")},
-         {OpEnc::OI, {"0"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB8")},
-         {OpEnc::OI, {"0"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xB8")},
-         {OpEnc::OI, {"0"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xB9")},
-         {OpEnc::OI, {"1"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xB9")},
-         {OpEnc::OI, {"1"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xB9")},
-         {OpEnc::OI, {"1"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xBA")},
-         {OpEnc::OI, {"2"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xBA")},
-         {OpEnc::OI, {"2"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xBA")},
-         {OpEnc::OI, {"2"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xBB")},
-         {OpEnc::OI, {"3"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xBB")},
-         {OpEnc::OI, {"3"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xBB")},
-         {OpEnc::OI, {"3"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xBC")},
-         {OpEnc::OI, {"4"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xBC")},
-         {OpEnc::OI, {"4"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xBC")},
-         {OpEnc::OI, {"4"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xBD")},
-         {OpEnc::OI, {"5"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xBD")},
-         {OpEnc::OI, {"5"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xBD")},
-         {OpEnc::OI, {"5"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xBE")},
-         {OpEnc::OI, {"6"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xBE")},
-         {OpEnc::OI, {"6"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xBE")},
-         {OpEnc::OI, {"6"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xBF")},
-         {OpEnc::OI, {"7"}, {Operand::reg16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xBF")},
-         {OpEnc::OI, {"7"}, {Operand::reg32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xBF")},
-         {OpEnc::OI, {"7"}, {Operand::reg64, Operand::imm64}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xC6")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::REX, Mnemonic::MOV, u2d("\xC6")},
-         {OpEnc::MI, {"ib"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::MOV, u2d("\xC7")},
-         {OpEnc::MI, {"iw"}, {Operand::rm16, Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::MOV, u2d("\xC7")},
-         {OpEnc::MI, {"id"}, {Operand::rm32, Operand::imm32}}},
-        {{Prefix::REXW, Mnemonic::MOV, u2d("\xC7")},
-         {OpEnc::MI, {"id"}, {Operand::rm64, Operand::imm32}}},
-
-        // CBW
-        {{Prefix::P66, Mnemonic::CBW, u2d("\x98")}, {OpEnc::NP, {}, {}}},
-
-        // CWDE
-        {{Prefix::NONE, Mnemonic::CWDE, u2d("\x98")}, {OpEnc::NP, {}, {}}},
-
-        // CDQE
-        {{Prefix::REXW, Mnemonic::CDQE, u2d("\x98")}, {OpEnc::NP, {}, {}}},
-
-        // CWD
-        {{Prefix::P66, Mnemonic::CWD, u2d("\x99")}, {OpEnc::NP, {}, {}}},
-
-        // CDQ
-        {{Prefix::NONE, Mnemonic::CDQ, u2d("\x99")}, {OpEnc::NP, {}, {}}},
-
-        // CQO
-        {{Prefix::REXW, Mnemonic::CQO, u2d("\x99")}, {OpEnc::NP, {}, {}}},
-
-        // MOVSX
-        {{Prefix::P66, Mnemonic::MOVSX, u2d("\x0F\xBE")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::MOVSX, u2d("\x0F\xBE")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::MOVSX, u2d("\x0F\xBE")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::MOVSX, u2d("\x0F\xBF")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm16}}},
-        {{Prefix::REXW, Mnemonic::MOVSX, u2d("\x0F\xBF")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm16}}},
-        {{Prefix::P66, Mnemonic::MOVZX, u2d("\x0F\xB6")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::MOVZX, u2d("\x0F\xB6")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm8}}},
-        {{Prefix::REX, Mnemonic::MOVZX, u2d("\x0F\xB6")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm8}}},
-        {{Prefix::NONE, Mnemonic::MOVZX, u2d("\x0F\xB7")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm16}}},
-        {{Prefix::REXW, Mnemonic::MOVZX, u2d("\x0F\xB7")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm32}}},
-
-        // MOVSXD
-        {{Prefix::REXW, Mnemonic::MOVSXD, u2d("\x63")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm32}}},
-
-        // LEA
-        {{Prefix::P66, Mnemonic::LEA, u2d("\x8D")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::m}}},
-        {{Prefix::NONE, Mnemonic::LEA, u2d("\x8D")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::m}}},
-        {{Prefix::REXW, Mnemonic::LEA, u2d("\x8D")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::m}}},
-
-        // BSWAP
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xC8")},
-         {OpEnc::O, {"0"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xC8")},
-         {OpEnc::O, {"0"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xC9")},
-         {OpEnc::O, {"1"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xC9")},
-         {OpEnc::O, {"1"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xCA")},
-         {OpEnc::O, {"2"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xCA")},
-         {OpEnc::O, {"2"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xCB")},
-         {OpEnc::O, {"3"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xCB")},
-         {OpEnc::O, {"3"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xCC")},
-         {OpEnc::O, {"4"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xCC")},
-         {OpEnc::O, {"4"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xCD")},
-         {OpEnc::O, {"5"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xCD")},
-         {OpEnc::O, {"5"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xCE")},
-         {OpEnc::O, {"6"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xCE")},
-         {OpEnc::O, {"6"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::BSWAP, u2d("\x0F\xCF")},
-         {OpEnc::O, {"7"}, {Operand::reg32}}},
-        {{Prefix::REXW, Mnemonic::BSWAP, u2d("\x0F\xCF")},
-         {OpEnc::O, {"7"}, {Operand::reg64}}},
-
-        /*
-        // XCHG AX, r16
-        {{Prefix::P66, Mnemonic::XCHG, u2d("\x90"), Opcode_plus_rw()},
-         {OpEnc::NP, {"rw"}, {Operand::ax, Operand::reg16}}},
-        {{Prefix::P66, Mnemonic::XCHG, u2d("\x90"), Opcode_plus_rw()},
-         {OpEnc::NP, {"rw"}, {Operand::reg16, Operand::ax}}},
-        {{Prefix::NONE, Mnemonic::XCHG, u2d("\x90"), Opcode_plus_rd()},
-         {OpEnc::NP, {"rd"}, {Operand::eax, Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::XCHG, u2d("\x90"), Opcode_plus_rd()},
-         {OpEnc::NP, {"rd"}, {Operand::reg32, Operand::eax}}},
-        {{Prefix::REXW, Mnemonic::XCHG, u2d("\x90"), Opcode_plus_rd()},
-         {OpEnc::NP, {"rd"}, {Operand::rax, Operand::reg64}}},
-        {{Prefix::REXW, Mnemonic::XCHG, u2d("\x90"), Opcode_plus_rd()},
-         {OpEnc::NP, {"rd"}, {Operand::reg64, Operand::rax}}},
-        */
-
-        {{Prefix::NONE, Mnemonic::XCHG, u2d("\x86")},
-         {OpEnc::RM, {"/r"}, {Operand::rm8, Operand::reg8}}},
-        {{Prefix::NONE, Mnemonic::XCHG, u2d("\x86")},
-         {OpEnc::RM, {"/r"}, {Operand::reg8, Operand::rm8}}},
-        {{Prefix::P66, Mnemonic::XCHG, u2d("\x87")},
-         {OpEnc::RM, {"/r"}, {Operand::rm16, Operand::reg16}}},
-        {{Prefix::P66, Mnemonic::XCHG, u2d("\x87")},
-         {OpEnc::RM, {"/r"}, {Operand::reg16, Operand::rm16}}},
-        {{Prefix::NONE, Mnemonic::XCHG, u2d("\x87")},
-         {OpEnc::RM, {"/r"}, {Operand::rm32, Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::XCHG, u2d("\x87")},
-         {OpEnc::RM, {"/r"}, {Operand::reg32, Operand::rm32}}},
-        {{Prefix::REXW, Mnemonic::XCHG, u2d("\x87")},
-         {OpEnc::RM, {"/r"}, {Operand::rm64, Operand::reg64}}},
-        {{Prefix::REXW, Mnemonic::XCHG, u2d("\x87")},
-         {OpEnc::RM, {"/r"}, {Operand::reg64, Operand::rm64}}},
-
-        // NOP
-        {{Prefix::NONE, Mnemonic::NOP, u2d("\x90")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::NOP, u2d("\x0F\x1F")},
-         {OpEnc::M, {"0"}, {Operand::rm32}}},
-
-        // RET
-        {{Prefix::NONE, Mnemonic::RET, u2d("\xC3")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::RET, u2d("\xCB")}, {OpEnc::NP, {}, {}}},
-        {{Prefix::NONE, Mnemonic::RET, u2d("\xC2")},
-         {OpEnc::I, {"iw"}, {Operand::imm16}}},
-        {{Prefix::NONE, Mnemonic::RET, u2d("\xCA")},
-         {OpEnc::I, {"iw"}, {Operand::imm16}}},
-
-        // CALL
-        {{Prefix::NONE, Mnemonic::CALL, u2d("\xE8")},
-         {OpEnc::D, {}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::CALL, u2d("\xFF")},
-         {OpEnc::D, {"2"}, {Operand::rm64}}},
-
-        // JCC
-        {{Prefix::NONE, Mnemonic::JO, u2d("\x0F\x80")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNO, u2d("\x0F\x81")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNAE, u2d("\x0F\x82")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNB, u2d("\x0F\x83")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JZ, u2d("\x0F\x84")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNZ, u2d("\x0F\x85")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNA, u2d("\x0F\x86")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNBE, u2d("\x0F\x87")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JS, u2d("\x0F\x88")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNS, u2d("\x0F\x89")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JP, u2d("\x0F\x8A")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JPO, u2d("\x0F\x8B")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNGE, u2d("\x0F\x8C")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNL, u2d("\x0F\x8D")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNG, u2d("\x0F\x8E")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JNLE, u2d("\x0F\x8F")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-
-        {{Prefix::NONE, Mnemonic::JO, u2d("\x70")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNO, u2d("\x71")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNAE, u2d("\x72")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNB, u2d("\x73")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JZ, u2d("\x74")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNZ, u2d("\x75")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNA, u2d("\x76")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNBE, u2d("\x77")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JS, u2d("\x78")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNS, u2d("\x79")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JP, u2d("\x7A")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JPO, u2d("\x7B")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNGE, u2d("\x7C")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNL, u2d("\x7D")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNG, u2d("\x7E")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JNLE, u2d("\x7F")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-
-        // JMP
-        {{Prefix::NONE, Mnemonic::JMP, u2d("\xEB")},
-         {OpEnc::D, {"cb"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::JMP, u2d("\xE9")},
-         {OpEnc::D, {"cd"}, {Operand::imm32}}},
-        {{Prefix::NONE, Mnemonic::JMP, u2d("\xFF")},
-         {OpEnc::M, {"4"}, {Operand::rm64}}},
-
-        // POP
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x8F")},
-         {OpEnc::M, {"0"}, {Operand::rm64}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x58")},
-         {OpEnc::O, {"0"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x59")},
-         {OpEnc::O, {"1"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x5A")},
-         {OpEnc::O, {"2"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x5B")},
-         {OpEnc::O, {"3"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x5C")},
-         {OpEnc::O, {"4"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x5D")},
-         {OpEnc::O, {"5"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x5E")},
-         {OpEnc::O, {"6"}, {Operand::reg32}}},
-        {{Prefix::NONE, Mnemonic::POP, u2d("\x5F")},
-         {OpEnc::O, {"7"}, {Operand::reg32}}},
-
-        // PUSH
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\xFF")},
-         {OpEnc::M, {"6"}, {Operand::rm64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x50")},
-         {OpEnc::O, {"0"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x51")},
-         {OpEnc::O, {"1"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x52")},
-         {OpEnc::O, {"2"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x53")},
-         {OpEnc::O, {"3"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x54")},
-         {OpEnc::O, {"4"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x55")},
-         {OpEnc::O, {"5"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x56")},
-         {OpEnc::O, {"6"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x57")},
-         {OpEnc::O, {"7"}, {Operand::reg64}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x6A")},
-         {OpEnc::I, {"ib"}, {Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::PUSH, u2d("\x68")},
-         {OpEnc::I, {"id"}, {Operand::imm32}}},
-
-        {{Prefix::NONE, Mnemonic::SAL, u2d("\xD0")},
-         {OpEnc::M1, {"4"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::SAL, u2d("\xD0")},
-         {OpEnc::M1, {"4"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::SAL, u2d("\xD2")},
-         {OpEnc::MC, {"4"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::SAL, u2d("\xD2")},
-         {OpEnc::MC, {"4"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::SAL, u2d("\xC0")},
-         {OpEnc::MI, {"4"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SAL, u2d("\xC0")},
-         {OpEnc::MI, {"4"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::SAL, u2d("\xD1")},
-         {OpEnc::M1, {"4"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::SAL, u2d("\xD1")},
-         {OpEnc::M1, {"4"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::SAL, u2d("\xD1")},
-         {OpEnc::M1, {"4"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::SAL, u2d("\xD3")},
-         {OpEnc::MC, {"4"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::SAL, u2d("\xD3")},
-         {OpEnc::MC, {"4"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::SAL, u2d("\xD3")},
-         {OpEnc::MC, {"4"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::SAL, u2d("\xC1")},
-         {OpEnc::MI, {"4"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SAL, u2d("\xC1")},
-         {OpEnc::MI, {"4"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SAL, u2d("\xC1")},
-         {OpEnc::MI, {"4"}, {Operand::rm64, Operand::imm8}}},
-
-        {{Prefix::NONE, Mnemonic::SAR, u2d("\xD0")},
-         {OpEnc::M1, {"7"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::SAR, u2d("\xD0")},
-         {OpEnc::M1, {"7"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::SAR, u2d("\xD2")},
-         {OpEnc::MC, {"7"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::SAR, u2d("\xD2")},
-         {OpEnc::MC, {"7"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::SAR, u2d("\xC0")},
-         {OpEnc::MI, {"7"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SAR, u2d("\xC0")},
-         {OpEnc::MI, {"7"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::SAR, u2d("\xD1")},
-         {OpEnc::M1, {"7"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::SAR, u2d("\xD1")},
-         {OpEnc::M1, {"7"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::SAR, u2d("\xD1")},
-         {OpEnc::M1, {"7"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::SAR, u2d("\xD3")},
-         {OpEnc::MC, {"7"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::SAR, u2d("\xD3")},
-         {OpEnc::MC, {"7"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::SAR, u2d("\xD3")},
-         {OpEnc::MC, {"7"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::SAR, u2d("\xC1")},
-         {OpEnc::MI, {"7"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SAR, u2d("\xC1")},
-         {OpEnc::MI, {"7"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SAR, u2d("\xC1")},
-         {OpEnc::MI, {"7"}, {Operand::rm64, Operand::imm8}}},
-
-        {{Prefix::NONE, Mnemonic::SHR, u2d("\xD0")},
-         {OpEnc::M1, {"5"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::SHR, u2d("\xD0")},
-         {OpEnc::M1, {"5"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::SHR, u2d("\xD2")},
-         {OpEnc::MC, {"5"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::SHR, u2d("\xD2")},
-         {OpEnc::MC, {"5"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::SHR, u2d("\xC0")},
-         {OpEnc::MI, {"5"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SHR, u2d("\xC0")},
-         {OpEnc::MI, {"5"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::SHR, u2d("\xD1")},
-         {OpEnc::M1, {"5"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::SHR, u2d("\xD1")},
-         {OpEnc::M1, {"5"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::SHR, u2d("\xD1")},
-         {OpEnc::M1, {"5"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::SHR, u2d("\xD3")},
-         {OpEnc::MC, {"5"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::SHR, u2d("\xD3")},
-         {OpEnc::MC, {"5"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::SHR, u2d("\xD3")},
-         {OpEnc::MC, {"5"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::SHR, u2d("\xC1")},
-         {OpEnc::MI, {"5"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::SHR, u2d("\xC1")},
-         {OpEnc::MI, {"5"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::SHR, u2d("\xC1")},
-         {OpEnc::MI, {"5"}, {Operand::rm64, Operand::imm8}}},
-
-        {{Prefix::NONE, Mnemonic::RCL, u2d("\xD0")},
-         {OpEnc::M1, {"2"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::RCL, u2d("\xD0")},
-         {OpEnc::M1, {"2"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::RCL, u2d("\xD2")},
-         {OpEnc::MC, {"2"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::RCL, u2d("\xD2")},
-         {OpEnc::MC, {"2"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::RCL, u2d("\xC0")},
-         {OpEnc::MI, {"2"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::RCL, u2d("\xC0")},
-         {OpEnc::MI, {"2"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::RCL, u2d("\xD1")},
-         {OpEnc::M1, {"2"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::RCL, u2d("\xD1")},
-         {OpEnc::M1, {"2"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::RCL, u2d("\xD1")},
-         {OpEnc::M1, {"2"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::RCL, u2d("\xD3")},
-         {OpEnc::MC, {"2"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::RCL, u2d("\xD3")},
-         {OpEnc::MC, {"2"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::RCL, u2d("\xD3")},
-         {OpEnc::MC, {"2"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::RCL, u2d("\xC1")},
-         {OpEnc::MI, {"2"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::RCL, u2d("\xC1")},
-         {OpEnc::MI, {"2"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::RCL, u2d("\xC1")},
-         {OpEnc::MI, {"2"}, {Operand::rm64, Operand::imm8}}},
-
-        {{Prefix::NONE, Mnemonic::RCR, u2d("\xD0")},
-         {OpEnc::M1, {"3"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::RCR, u2d("\xD0")},
-         {OpEnc::M1, {"3"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::RCR, u2d("\xD2")},
-         {OpEnc::MC, {"3"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::RCR, u2d("\xD2")},
-         {OpEnc::MC, {"3"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::RCR, u2d("\xC0")},
-         {OpEnc::MI, {"3"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::RCR, u2d("\xC0")},
-         {OpEnc::MI, {"3"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::RCR, u2d("\xD1")},
-         {OpEnc::M1, {"3"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::RCR, u2d("\xD1")},
-         {OpEnc::M1, {"3"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::RCR, u2d("\xD1")},
-         {OpEnc::M1, {"3"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::RCR, u2d("\xD3")},
-         {OpEnc::MC, {"3"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::RCR, u2d("\xD3")},
-         {OpEnc::MC, {"3"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::RCR, u2d("\xD3")},
-         {OpEnc::MC, {"3"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::RCR, u2d("\xC1")},
-         {OpEnc::MI, {"3"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::RCR, u2d("\xC1")},
-         {OpEnc::MI, {"3"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::RCR, u2d("\xC1")},
-         {OpEnc::MI, {"3"}, {Operand::rm64, Operand::imm8}}},
-
-        {{Prefix::NONE, Mnemonic::ROL, u2d("\xD0")},
-         {OpEnc::M1, {"0"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::ROL, u2d("\xD0")},
-         {OpEnc::M1, {"0"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::ROL, u2d("\xD2")},
-         {OpEnc::MC, {"0"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::ROL, u2d("\xD2")},
-         {OpEnc::MC, {"0"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::ROL, u2d("\xC0")},
-         {OpEnc::MI, {"0"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ROL, u2d("\xC0")},
-         {OpEnc::MI, {"0"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::ROL, u2d("\xD1")},
-         {OpEnc::M1, {"0"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::ROL, u2d("\xD1")},
-         {OpEnc::M1, {"0"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::ROL, u2d("\xD1")},
-         {OpEnc::M1, {"0"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::ROL, u2d("\xD3")},
-         {OpEnc::MC, {"0"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::ROL, u2d("\xD3")},
-         {OpEnc::MC, {"0"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::ROL, u2d("\xD3")},
-         {OpEnc::MC, {"0"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::ROL, u2d("\xC1")},
-         {OpEnc::MI, {"0"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ROL, u2d("\xC1")},
-         {OpEnc::MI, {"0"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::ROL, u2d("\xC1")},
-         {OpEnc::MI, {"0"}, {Operand::rm64, Operand::imm8}}},
-
-        {{Prefix::NONE, Mnemonic::ROR, u2d("\xD0")},
-         {OpEnc::M1, {"1"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::REX, Mnemonic::ROR, u2d("\xD0")},
-         {OpEnc::M1, {"1"}, {Operand::rm8, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::ROR, u2d("\xD2")},
-         {OpEnc::MC, {"1"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::REX, Mnemonic::ROR, u2d("\xD2")},
-         {OpEnc::MC, {"1"}, {Operand::rm8, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::ROR, u2d("\xC0")},
-         {OpEnc::MI, {"1"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ROR, u2d("\xC0")},
-         {OpEnc::MI, {"1"}, {Operand::rm8, Operand::imm8}}},
-        {{Prefix::P66, Mnemonic::ROR, u2d("\xD1")},
-         {OpEnc::M1, {"1"}, {Operand::rm16, Operand::one}}},
-        {{Prefix::NONE, Mnemonic::ROR, u2d("\xD1")},
-         {OpEnc::M1, {"1"}, {Operand::rm32, Operand::one}}},
-        {{Prefix::REXW, Mnemonic::ROR, u2d("\xD1")},
-         {OpEnc::M1, {"1"}, {Operand::rm64, Operand::one}}},
-        {{Prefix::P66, Mnemonic::ROR, u2d("\xD3")},
-         {OpEnc::MC, {"1"}, {Operand::rm16, Operand::cl}}},
-        {{Prefix::NONE, Mnemonic::ROR, u2d("\xD3")},
-         {OpEnc::MC, {"1"}, {Operand::rm32, Operand::cl}}},
-        {{Prefix::REXW, Mnemonic::ROR, u2d("\xD3")},
-         {OpEnc::MC, {"1"}, {Operand::rm64, Operand::cl}}},
-        {{Prefix::P66, Mnemonic::ROR, u2d("\xC1")},
-         {OpEnc::MI, {"1"}, {Operand::rm16, Operand::imm8}}},
-        {{Prefix::NONE, Mnemonic::ROR, u2d("\xC1")},
-         {OpEnc::MI, {"1"}, {Operand::rm32, Operand::imm8}}},
-        {{Prefix::REXW, Mnemonic::ROR, u2d("\xC1")},
-         {OpEnc::MI, {"1"}, {Operand::rm64, Operand::imm8}}},
+// (prefix, operator, opcode) -> (encoding, remaining opcode, operands)
+inline constexpr OperandEntry OPERAND_ENTRIES[] = {
+    // SETNE
+    {Prefix::NONE, Mnemonic::SETNE, 0x0F95, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::SETNE, 0x0F95, OpEnc::M, "", {Operand::rm8}},
+
+    {Prefix::NONE, Mnemonic::FADD, 0xD8, OpEnc::M, "0", {Operand::m32fp}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDC, OpEnc::M, "0", {Operand::m64fp}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C0, OpEnc::NP, "0",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C1, OpEnc::NP, "1",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C2, OpEnc::NP, "2",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C3, OpEnc::NP, "3",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C4, OpEnc::NP, "4",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C5, OpEnc::NP, "5",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C6, OpEnc::NP, "6",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xD8C7, OpEnc::NP, "7",
+     {Operand::st0, Operand::sti}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC0, OpEnc::NP, "0",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC1, OpEnc::NP, "1",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC2, OpEnc::NP, "2",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC3, OpEnc::NP, "3",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC4, OpEnc::NP, "4",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC5, OpEnc::NP, "5",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC6, OpEnc::NP, "6",
+     {Operand::sti, Operand::st0}},
+    {Prefix::NONE, Mnemonic::FADD, 0xDCC7, OpEnc::NP, "7",
+     {Operand::sti, Operand::st0}},
+
+    // FXCH
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9C8, OpEnc::NP, "0", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9C9, OpEnc::NP, "1", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9CA, OpEnc::NP, "2", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9CB, OpEnc::NP, "3", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9CC, OpEnc::NP, "4", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9CD, OpEnc::NP, "5", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9CE, OpEnc::NP, "6", {Operand::sti}},
+    {Prefix::NONE, Mnemonic::FXCH, 0xD9CF, OpEnc::NP, "7", {Operand::sti}},
+
+    // CMOVE
+    {Prefix::NONE, Mnemonic::CMOVE, 0x0F44, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+
+    // MOVAPS
+    {Prefix::NONE, Mnemonic::MOVAPS, 0x0F28, OpEnc::A, "/r",
+     {Operand::xmm, Operand::xm128}},
+    {Prefix::NONE, Mnemonic::MOVAPS, 0x0F29, OpEnc::B, "/r",
+     {Operand::xm128, Operand::xmm}},
+
+
+    // IN
+    {Prefix::NONE, Mnemonic::IN, 0xE4, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::IN, 0xE5, OpEnc::I, "ib",
+     {Operand::eax, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::IN, 0xEC, OpEnc::NP, "",
+     {Operand::al, Operand::dx}},
+    {Prefix::NONE, Mnemonic::IN, 0xED, OpEnc::NP, "",
+     {Operand::eax, Operand::dx}},
+
+    // OUT
+    {Prefix::NONE, Mnemonic::OUT, 0xE6, OpEnc::I, "ib",
+     {Operand::imm8, Operand::al}},
+    {Prefix::NONE, Mnemonic::OUT, 0xE7, OpEnc::I, "ib",
+     {Operand::imm8, Operand::eax}},
+    {Prefix::NONE, Mnemonic::OUT, 0xEE, OpEnc::NP, "",
+     {Operand::dx, Operand::al}},
+    {Prefix::NONE, Mnemonic::OUT, 0xEF, OpEnc::NP, "",
+     {Operand::dx, Operand::eax}},
+
+    // LOOP
+    {Prefix::NONE, Mnemonic::LOOP, 0xE2, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::LOOPE, 0xE1, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::LOOPNE, 0xE0, OpEnc::D, "cb", {Operand::imm8}},
+
+    // SHLD
+    {Prefix::NONE, Mnemonic::SHLD, 0x0FA4, OpEnc::MRI, "ib",
+     {Operand::rm32, Operand::reg32, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SHLD, 0x0FA5, OpEnc::MRC, "/r",
+     {Operand::rm32, Operand::reg32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::SHLD, 0x0FA4, OpEnc::MRI, "ib",
+     {Operand::rm64, Operand::reg64, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SHLD, 0x0FA5, OpEnc::MRC, "/r",
+     {Operand::rm64, Operand::reg64, Operand::cl}},
+
+    // SHRD
+    {Prefix::NONE, Mnemonic::SHRD, 0x0FAC, OpEnc::MRI, "ib",
+     {Operand::rm32, Operand::reg32, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SHRD, 0x0FAD, OpEnc::MRC, "/r",
+     {Operand::rm32, Operand::reg32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::SHRD, 0x0FAC, OpEnc::MRI, "ib",
+     {Operand::rm64, Operand::reg64, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SHRD, 0x0FAD, OpEnc::MRC, "/r",
+     {Operand::rm64, Operand::reg64, Operand::cl}},
+
+    {Prefix::NONE, Mnemonic::JECXZ, 0xE3, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::INSB, 0x6C, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::INSW, 0x6D, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::OUTSB, 0x6E, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::OUTSW, 0x6F, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::STOSB, 0xAA, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::STOSW, 0xAB, OpEnc::NP, "", {}},
+    {Prefix::REXW, Mnemonic::STOSQ, 0xAB, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::SCASB, 0xAE, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::SCASW, 0xAF, OpEnc::NP, "", {}},
+    {Prefix::REXW, Mnemonic::SCASQ, 0xAF, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::LODSB, 0xAC, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::LODSW, 0xAD, OpEnc::NP, "", {}},
+    {Prefix::REXW, Mnemonic::LODSQ, 0xAD, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::MOVSB, 0xA4, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::MOVSW, 0xA5, OpEnc::NP, "", {}},
+    {Prefix::REXW, Mnemonic::MOVSQ, 0xA5, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::CMPSB, 0xA6, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::CMPSW, 0xA7, OpEnc::NP, "", {}},
+    {Prefix::REXW, Mnemonic::CMPSQ, 0xA7, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::CPUID, 0x0FA2, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::LEAVE, 0xC9, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::CLC, 0xF8, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::CLD, 0xFC, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::STC, 0xF9, OpEnc::NP, "", {}},
+    // ADD
+    {Prefix::NONE, Mnemonic::ADD, 0x04, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ADD, 0x05, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::ADD, 0x05, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::ADD, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::ADD, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ADD, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::ADD, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::ADD, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::ADD, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ADD, 0x00, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::NONE, Mnemonic::ADD, 0x01, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::ADD, 0x01, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::NONE, Mnemonic::ADD, 0x02, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::ADD, 0x02, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::ADD, 0x03, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::ADD, 0x03, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // ADC
+    {Prefix::NONE, Mnemonic::ADC, 0x14, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ADC, 0x15, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::ADC, 0x15, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::ADC, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::ADC, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ADC, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::ADC, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::ADC, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::ADC, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ADC, 0x10, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::ADC, 0x10, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::NONE, Mnemonic::ADC, 0x11, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::ADC, 0x11, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::NONE, Mnemonic::ADC, 0x12, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::ADC, 0x12, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::ADC, 0x13, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::ADC, 0x13, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // SUB
+    {Prefix::NONE, Mnemonic::SUB, 0x2C, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SUB, 0x2D, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::SUB, 0x2D, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::SUB, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::SUB, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SUB, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::SUB, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::SUB, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SUB, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SUB, 0x29, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::SUB, 0x29, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::NONE, Mnemonic::SUB, 0x2A, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::SUB, 0x2A, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::SUB, 0x2B, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::SUB, 0x2B, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+    {Prefix::NONE, Mnemonic::SUB, 0x28, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::SUB, 0x28, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+
+    // SBB
+    {Prefix::NONE, Mnemonic::SBB, 0x1C, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SBB, 0x1D, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::SBB, 0x1D, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::SBB, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::SBB, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SBB, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::SBB, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::SBB, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SBB, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SBB, 0x19, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::SBB, 0x19, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::NONE, Mnemonic::SBB, 0x1A, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::SBB, 0x1A, OpEnc::RM, "ib",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::SBB, 0x1B, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::SBB, 0x1B, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // INC
+    {Prefix::NONE, Mnemonic::INC, 0xFE, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::INC, 0xFE, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::NONE, Mnemonic::INC, 0xFF, OpEnc::M, "", {Operand::rm32}},
+    {Prefix::REXW, Mnemonic::INC, 0xFF, OpEnc::M, "", {Operand::rm64}},
+
+    // DEC
+    {Prefix::NONE, Mnemonic::DEC, 0xFE, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::DEC, 0xFE, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::NONE, Mnemonic::DEC, 0xFF, OpEnc::M, "", {Operand::rm32}},
+    {Prefix::REXW, Mnemonic::DEC, 0xFF, OpEnc::M, "", {Operand::rm64}},
+
+    // NEG
+    {Prefix::NONE, Mnemonic::NEG, 0xF6, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::NEG, 0xF6, OpEnc::M, "", {Operand::rm8}},
+    {Prefix::NONE, Mnemonic::NEG, 0xF7, OpEnc::M, "", {Operand::rm32}},
+    {Prefix::REXW, Mnemonic::NEG, 0xF7, OpEnc::M, "", {Operand::rm64}},
+
+    // AND
+    {Prefix::NONE, Mnemonic::AND, 0x24, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::P66, Mnemonic::AND, 0x25, OpEnc::I, "iw",
+     {Operand::ax, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::AND, 0x25, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::AND, 0x25, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::AND, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::AND, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::AND, 0x81, OpEnc::MI, "id",
+     {Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::AND, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::AND, 0x81, OpEnc::MI, "id",
+     {Operand::rm64, Operand::imm32}},
+    {Prefix::P66, Mnemonic::AND, 0x83, OpEnc::MI, "ib",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::AND, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::AND, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::AND, 0x20, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::AND, 0x20, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::NONE, Mnemonic::AND, 0x22, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::AND, 0x22, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::P66, Mnemonic::AND, 0x21, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::NONE, Mnemonic::AND, 0x21, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::AND, 0x21, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::P66, Mnemonic::AND, 0x23, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::AND, 0x23, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::AND, 0x23, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // OR
+    {Prefix::NONE, Mnemonic::OR, 0x0C, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::P66, Mnemonic::OR, 0x0D, OpEnc::I, "iw",
+     {Operand::ax, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::OR, 0x0D, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::OR, 0x0D, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::OR, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::OR, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::OR, 0x81, OpEnc::MI, "id",
+     {Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::OR, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::OR, 0x81, OpEnc::MI, "id",
+     {Operand::rm64, Operand::imm32}},
+    {Prefix::P66, Mnemonic::OR, 0x83, OpEnc::MI, "ib",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::OR, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::OR, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::P66, Mnemonic::OR, 0x09, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::NONE, Mnemonic::OR, 0x08, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::OR, 0x08, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::NONE, Mnemonic::OR, 0x09, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::OR, 0x09, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::P66, Mnemonic::OR, 0x0B, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::OR, 0x0B, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::OR, 0x0B, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // XOR
+    {Prefix::NONE, Mnemonic::XOR, 0x30, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::XOR, 0x30, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::NONE, Mnemonic::XOR, 0x34, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::P66, Mnemonic::XOR, 0x35, OpEnc::I, "iw",
+     {Operand::ax, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::XOR, 0x35, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::XOR, 0x35, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::P66, Mnemonic::XOR, 0x81, OpEnc::MI, "id",
+     {Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::XOR, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::XOR, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::P66, Mnemonic::XOR, 0x83, OpEnc::MI, "ib",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::XOR, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::XOR, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::P66, Mnemonic::XOR, 0x31, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::NONE, Mnemonic::XOR, 0x31, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::XOR, 0x31, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::P66, Mnemonic::XOR, 0x33, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::XOR, 0x33, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::XOR, 0x33, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // NOT
+    {Prefix::NONE, Mnemonic::NOT, 0xF6, OpEnc::RM, "", {Operand::reg8}},
+    {Prefix::REX, Mnemonic::NOT, 0xF6, OpEnc::RM, "", {Operand::reg8}},
+    {Prefix::P66, Mnemonic::NOT, 0xF7, OpEnc::RM, "", {Operand::reg16}},
+    {Prefix::NONE, Mnemonic::NOT, 0xF7, OpEnc::RM, "", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::NOT, 0xF7, OpEnc::RM, "", {Operand::reg64}},
+
+    // MUL
+    {Prefix::NONE, Mnemonic::MUL, 0xF6, OpEnc::RM, "", {Operand::reg8}},
+    {Prefix::REX, Mnemonic::MUL, 0xF6, OpEnc::RM, "", {Operand::reg8}},
+    {Prefix::P66, Mnemonic::MUL, 0xF7, OpEnc::RM, "", {Operand::reg16}},
+    {Prefix::NONE, Mnemonic::MUL, 0xF7, OpEnc::RM, "", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::MUL, 0xF7, OpEnc::RM, "", {Operand::reg64}},
+
+    // IMUL
+    {Prefix::NONE, Mnemonic::IMUL, 0xF6, OpEnc::MR, "/r", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::IMUL, 0xF6, OpEnc::MR, "/r", {Operand::rm8}},
+    {Prefix::P66, Mnemonic::IMUL, 0xF7, OpEnc::MR, "/r", {Operand::rm16}},
+    {Prefix::NONE, Mnemonic::IMUL, 0xF7, OpEnc::MR, "/r", {Operand::rm32}},
+    {Prefix::REXW, Mnemonic::IMUL, 0xF7, OpEnc::MR, "/r", {Operand::rm64}},
+    {Prefix::P66, Mnemonic::IMUL, 0x0FAF, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::IMUL, 0x0FAF, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::IMUL, 0x0FAF, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+    {Prefix::P66, Mnemonic::IMUL, 0x6B, OpEnc::RMI, "ib",
+     {Operand::reg16, Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::IMUL, 0x6B, OpEnc::RMI, "ib",
+     {Operand::reg32, Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::IMUL, 0x6B, OpEnc::RMI, "ib",
+     {Operand::reg64, Operand::rm64, Operand::imm8}},
+    {Prefix::P66, Mnemonic::IMUL, 0x6B, OpEnc::RMI, "ib",
+     {Operand::reg16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::IMUL, 0x6B, OpEnc::RMI, "ib",
+     {Operand::reg32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::IMUL, 0x6B, OpEnc::RMI, "ib",
+     {Operand::reg64, Operand::imm8}},
+    {Prefix::P66, Mnemonic::IMUL, 0x69, OpEnc::RMI, "iw",
+     {Operand::reg16, Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::IMUL, 0x69, OpEnc::RMI, "id",
+     {Operand::reg32, Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::IMUL, 0x69, OpEnc::RMI, "id",
+     {Operand::reg64, Operand::rm64, Operand::imm32}},
+    {Prefix::P66, Mnemonic::IMUL, 0x69, OpEnc::RMI, "iw",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::IMUL, 0x69, OpEnc::RMI, "id",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::IMUL, 0x69, OpEnc::RMI, "id",
+     {Operand::reg64, Operand::imm32}},
+
+    // DIV
+    {Prefix::NONE, Mnemonic::DIV, 0xF6, OpEnc::M, "/r", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::DIV, 0xF6, OpEnc::M, "/r", {Operand::rm8}},
+    {Prefix::P66, Mnemonic::DIV, 0xF7, OpEnc::M, "/r", {Operand::rm16}},
+    {Prefix::NONE, Mnemonic::DIV, 0xF7, OpEnc::M, "/r", {Operand::rm32}},
+    {Prefix::REXW, Mnemonic::DIV, 0xF7, OpEnc::M, "/r", {Operand::rm64}},
+
+    // IDIV
+    {Prefix::NONE, Mnemonic::IDIV, 0xF6, OpEnc::M, "/r", {Operand::rm8}},
+    {Prefix::REX, Mnemonic::IDIV, 0xF6, OpEnc::M, "/r", {Operand::rm8}},
+    {Prefix::P66, Mnemonic::IDIV, 0xF7, OpEnc::M, "/r", {Operand::rm16}},
+    {Prefix::NONE, Mnemonic::IDIV, 0xF7, OpEnc::M, "/r", {Operand::rm32}},
+    {Prefix::REXW, Mnemonic::IDIV, 0xF7, OpEnc::M, "/r", {Operand::rm64}},
+
+    // CMP
+    {Prefix::NONE, Mnemonic::CMP, 0x3C, OpEnc::I, "id",
+     {Operand::al, Operand::imm8}},
+    {Prefix::P66, Mnemonic::CMP, 0x3D, OpEnc::I, "id",
+     {Operand::ax, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::CMP, 0x3D, OpEnc::I, "id",
+     {Operand::eax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::CMP, 0x3D, OpEnc::I, "id",
+     {Operand::rax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::CMP, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::CMP, 0x80, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::CMP, 0x81, OpEnc::MI, "id",
+     {Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::CMP, 0x81, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::CMP, 0x81, OpEnc::MI, "id",
+     {Operand::rm64, Operand::imm32}},
+    {Prefix::P66, Mnemonic::CMP, 0x83, OpEnc::MI, "ib",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::CMP, 0x83, OpEnc::MI, "ib",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::CMP, 0x83, OpEnc::MI, "ib",
+     {Operand::rm64, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::CMP, 0x38, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::CMP, 0x38, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::P66, Mnemonic::CMP, 0x39, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::NONE, Mnemonic::CMP, 0x39, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::CMP, 0x39, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::P66, Mnemonic::CMP, 0x3B, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::CMP, 0x3A, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::CMP, 0x3A, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::CMP, 0x3B, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::CMP, 0x3B, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // TEST
+    {Prefix::NONE, Mnemonic::TEST, 0xA8, OpEnc::I, "ib",
+     {Operand::al, Operand::imm8}},
+    {Prefix::P66, Mnemonic::TEST, 0xA9, OpEnc::I, "iw",
+     {Operand::ax, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::TEST, 0xA9, OpEnc::I, "id",
+     {Operand::ax, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::TEST, 0xA9, OpEnc::I, "id",
+     {Operand::ax, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::TEST, 0xF6, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::TEST, 0xF6, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::TEST, 0xF7, OpEnc::MI, "iw",
+     {Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::TEST, 0xF7, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::TEST, 0xF7, OpEnc::MI, "id",
+     {Operand::rm64, Operand::imm32}},
+    {Prefix::NONE, Mnemonic::TEST, 0x84, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::TEST, 0x84, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::P66, Mnemonic::TEST, 0x85, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::NONE, Mnemonic::TEST, 0x85, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::TEST, 0x85, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+
+    // MOV
+    {Prefix::NONE, Mnemonic::MOV, 0x88, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::REX, Mnemonic::MOV, 0x88, OpEnc::MR, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::P66, Mnemonic::MOV, 0x89, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::NONE, Mnemonic::MOV, 0x89, OpEnc::MR, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::REXW, Mnemonic::MOV, 0x89, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::NONE, Mnemonic::MOV, 0x8A, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::REX, Mnemonic::MOV, 0x8A, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::P66, Mnemonic::MOV, 0x8B, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0x8B, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0x8B, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+    {Prefix::NONE, Mnemonic::MOV, 0x8C, OpEnc::MR, "/r",
+     {Operand::rm16, Operand::sreg}},
+    {Prefix::REXW, Mnemonic::MOV, 0x8C, OpEnc::MR, "/r",
+     {Operand::rm64, Operand::sreg}},
+    {Prefix::NONE, Mnemonic::MOV, 0x8E, OpEnc::RM, "/r",
+     {Operand::sreg, Operand::rm16}},
+    {Prefix::REXW, Mnemonic::MOV, 0x8E, OpEnc::RM, "/r",
+     {Operand::sreg, Operand::rm64}},
+    {Prefix::NONE, Mnemonic::MOV, 0xA0, OpEnc::FD, "",
+     {Operand::al, Operand::moffs8}},
+    {Prefix::REXW, Mnemonic::MOV, 0xA0, OpEnc::FD, "",
+     {Operand::al, Operand::moffs8}},
+    {Prefix::P66, Mnemonic::MOV, 0xA1, OpEnc::FD, "",
+     {Operand::ax, Operand::moffs16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xA1, OpEnc::FD, "",
+     {Operand::eax, Operand::moffs32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xA1, OpEnc::FD, "",
+     {Operand::rax, Operand::moffs64}},
+    {Prefix::NONE, Mnemonic::MOV, 0xA2, OpEnc::TD, "",
+     {Operand::moffs8, Operand::al}},
+    {Prefix::REXW, Mnemonic::MOV, 0xA2, OpEnc::TD, "",
+     {Operand::moffs8, Operand::al}},
+    {Prefix::P66, Mnemonic::MOV, 0xA3, OpEnc::TD, "",
+     {Operand::moffs16, Operand::ax}},
+    {Prefix::REXW, Mnemonic::MOV, 0xA3, OpEnc::TD, "",
+     {Operand::moffs64, Operand::rax}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB0, OpEnc::OI, "0",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB0, OpEnc::OI, "0",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB1, OpEnc::OI, "1",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB1, OpEnc::OI, "1",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB2, OpEnc::OI, "2",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB2, OpEnc::OI, "2",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB3, OpEnc::OI, "3",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB3, OpEnc::OI, "3",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB4, OpEnc::OI, "4",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB4, OpEnc::OI, "4",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB5, OpEnc::OI, "5",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB5, OpEnc::OI, "5",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB6, OpEnc::OI, "6",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB6, OpEnc::OI, "6",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB7, OpEnc::OI, "7",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xB7, OpEnc::OI, "7",
+     {Operand::reg8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::MOV, 0xB8, OpEnc::OI, "0",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB8, OpEnc::OI, "0",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xB8, OpEnc::OI, "0",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xB9, OpEnc::OI, "1",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xB9, OpEnc::OI, "1",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xB9, OpEnc::OI, "1",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xBA, OpEnc::OI, "2",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xBA, OpEnc::OI, "2",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xBA, OpEnc::OI, "2",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xBB, OpEnc::OI, "3",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xBB, OpEnc::OI, "3",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xBB, OpEnc::OI, "3",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xBC, OpEnc::OI, "4",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xBC, OpEnc::OI, "4",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xBC, OpEnc::OI, "4",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xBD, OpEnc::OI, "5",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xBD, OpEnc::OI, "5",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xBD, OpEnc::OI, "5",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xBE, OpEnc::OI, "6",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xBE, OpEnc::OI, "6",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xBE, OpEnc::OI, "6",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::P66, Mnemonic::MOV, 0xBF, OpEnc::OI, "7",
+     {Operand::reg16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xBF, OpEnc::OI, "7",
+     {Operand::reg32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xBF, OpEnc::OI, "7",
+     {Operand::reg64, Operand::imm64}},
+    {Prefix::NONE, Mnemonic::MOV, 0xC6, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::REX, Mnemonic::MOV, 0xC6, OpEnc::MI, "ib",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::MOV, 0xC7, OpEnc::MI, "iw",
+     {Operand::rm16, Operand::imm16}},
+    {Prefix::NONE, Mnemonic::MOV, 0xC7, OpEnc::MI, "id",
+     {Operand::rm32, Operand::imm32}},
+    {Prefix::REXW, Mnemonic::MOV, 0xC7, OpEnc::MI, "id",
+     {Operand::rm64, Operand::imm32}},
+
+    // CBW
+    {Prefix::P66, Mnemonic::CBW, 0x98, OpEnc::NP, "", {}},
+
+    // CWDE
+    {Prefix::NONE, Mnemonic::CWDE, 0x98, OpEnc::NP, "", {}},
+
+    // CDQE
+    {Prefix::REXW, Mnemonic::CDQE, 0x98, OpEnc::NP, "", {}},
+
+    // CWD
+    {Prefix::P66, Mnemonic::CWD, 0x99, OpEnc::NP, "", {}},
+
+    // CDQ
+    {Prefix::NONE, Mnemonic::CDQ, 0x99, OpEnc::NP, "", {}},
+
+    // CQO
+    {Prefix::REXW, Mnemonic::CQO, 0x99, OpEnc::NP, "", {}},
+
+    // MOVSX
+    {Prefix::P66, Mnemonic::MOVSX, 0x0FBE, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::MOVSX, 0x0FBE, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm8}},
+    {Prefix::REX, Mnemonic::MOVSX, 0x0FBE, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::MOVSX, 0x0FBF, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm16}},
+    {Prefix::REXW, Mnemonic::MOVSX, 0x0FBF, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm16}},
+    {Prefix::P66, Mnemonic::MOVZX, 0x0FB6, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::MOVZX, 0x0FB6, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm8}},
+    {Prefix::REX, Mnemonic::MOVZX, 0x0FB6, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm8}},
+    {Prefix::NONE, Mnemonic::MOVZX, 0x0FB7, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm16}},
+    {Prefix::REXW, Mnemonic::MOVZX, 0x0FB7, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm32}},
+
+    // MOVSXD
+    {Prefix::REXW, Mnemonic::MOVSXD, 0x63, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm32}},
+
+    // LEA
+    {Prefix::P66, Mnemonic::LEA, 0x8D, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::m}},
+    {Prefix::NONE, Mnemonic::LEA, 0x8D, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::m}},
+    {Prefix::REXW, Mnemonic::LEA, 0x8D, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::m}},
+
+    // BSWAP
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FC8, OpEnc::O, "0", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FC8, OpEnc::O, "0", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FC9, OpEnc::O, "1", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FC9, OpEnc::O, "1", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FCA, OpEnc::O, "2", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FCA, OpEnc::O, "2", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FCB, OpEnc::O, "3", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FCB, OpEnc::O, "3", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FCC, OpEnc::O, "4", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FCC, OpEnc::O, "4", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FCD, OpEnc::O, "5", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FCD, OpEnc::O, "5", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FCE, OpEnc::O, "6", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FCE, OpEnc::O, "6", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::BSWAP, 0x0FCF, OpEnc::O, "7", {Operand::reg32}},
+    {Prefix::REXW, Mnemonic::BSWAP, 0x0FCF, OpEnc::O, "7", {Operand::reg64}},
+
+    /*
+    // XCHG AX, r16
+    {Prefix::P66, Mnemonic::XCHG, 0x90 + rw, OpEnc::NP, "rw",
+     {Operand::ax, Operand::reg16}},
+    {Prefix::P66, Mnemonic::XCHG, 0x90 + rw, OpEnc::NP, "rw",
+     {Operand::reg16, Operand::ax}},
+    {Prefix::NONE, Mnemonic::XCHG, 0x90 + rd, OpEnc::NP, "rd",
+     {Operand::eax, Operand::reg32}},
+    {Prefix::NONE, Mnemonic::XCHG, 0x90 + rd, OpEnc::NP, "rd",
+     {Operand::reg32, Operand::eax}},
+    {Prefix::REXW, Mnemonic::XCHG, 0x90 + rd, OpEnc::NP, "rd",
+     {Operand::rax, Operand::reg64}},
+    {Prefix::REXW, Mnemonic::XCHG, 0x90 + rd, OpEnc::NP, "rd",
+     {Operand::reg64, Operand::rax}},
+    */
+
+    {Prefix::NONE, Mnemonic::XCHG, 0x86, OpEnc::RM, "/r",
+     {Operand::rm8, Operand::reg8}},
+    {Prefix::NONE, Mnemonic::XCHG, 0x86, OpEnc::RM, "/r",
+     {Operand::reg8, Operand::rm8}},
+    {Prefix::P66, Mnemonic::XCHG, 0x87, OpEnc::RM, "/r",
+     {Operand::rm16, Operand::reg16}},
+    {Prefix::P66, Mnemonic::XCHG, 0x87, OpEnc::RM, "/r",
+     {Operand::reg16, Operand::rm16}},
+    {Prefix::NONE, Mnemonic::XCHG, 0x87, OpEnc::RM, "/r",
+     {Operand::rm32, Operand::reg32}},
+    {Prefix::NONE, Mnemonic::XCHG, 0x87, OpEnc::RM, "/r",
+     {Operand::reg32, Operand::rm32}},
+    {Prefix::REXW, Mnemonic::XCHG, 0x87, OpEnc::RM, "/r",
+     {Operand::rm64, Operand::reg64}},
+    {Prefix::REXW, Mnemonic::XCHG, 0x87, OpEnc::RM, "/r",
+     {Operand::reg64, Operand::rm64}},
+
+    // NOP
+    {Prefix::NONE, Mnemonic::NOP, 0x90, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::NOP, 0x0F1F, OpEnc::M, "0", {Operand::rm32}},
+    {Prefix::P66, Mnemonic::NOP, 0x90, OpEnc::NP, "", {}},
+    {Prefix::P66, Mnemonic::NOP, 0x0F1F, OpEnc::M, "0", {Operand::rm16}},
+
+    // RET
+    {Prefix::NONE, Mnemonic::RET, 0xC3, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::RET, 0xCB, OpEnc::NP, "", {}},
+    {Prefix::NONE, Mnemonic::RET, 0xC2, OpEnc::I, "iw", {Operand::imm16}},
+    {Prefix::NONE, Mnemonic::RET, 0xCA, OpEnc::I, "iw", {Operand::imm16}},
+
+    // CALL
+    {Prefix::NONE, Mnemonic::CALL, 0xE8, OpEnc::D, "", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::CALL, 0xFF, OpEnc::D, "2", {Operand::rm64}},
+
+    // JCC
+    {Prefix::NONE, Mnemonic::JO, 0x0F80, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNO, 0x0F81, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNAE, 0x0F82, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNB, 0x0F83, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JZ, 0x0F84, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNZ, 0x0F85, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNA, 0x0F86, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNBE, 0x0F87, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JS, 0x0F88, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNS, 0x0F89, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JP, 0x0F8A, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JPO, 0x0F8B, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNGE, 0x0F8C, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNL, 0x0F8D, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNG, 0x0F8E, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JNLE, 0x0F8F, OpEnc::D, "cd", {Operand::imm32}},
+
+    {Prefix::NONE, Mnemonic::JO, 0x70, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNO, 0x71, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNAE, 0x72, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNB, 0x73, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JZ, 0x74, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNZ, 0x75, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNA, 0x76, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNBE, 0x77, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JS, 0x78, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNS, 0x79, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JP, 0x7A, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JPO, 0x7B, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNGE, 0x7C, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNL, 0x7D, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNG, 0x7E, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JNLE, 0x7F, OpEnc::D, "cb", {Operand::imm8}},
+
+    // JMP
+    {Prefix::NONE, Mnemonic::JMP, 0xEB, OpEnc::D, "cb", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::JMP, 0xE9, OpEnc::D, "cd", {Operand::imm32}},
+    {Prefix::NONE, Mnemonic::JMP, 0xFF, OpEnc::M, "4", {Operand::rm64}},
+
+    // POP
+    {Prefix::NONE, Mnemonic::POP, 0x8F, OpEnc::M, "0", {Operand::rm64}},
+    {Prefix::NONE, Mnemonic::POP, 0x58, OpEnc::O, "0", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x59, OpEnc::O, "1", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x5A, OpEnc::O, "2", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x5B, OpEnc::O, "3", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x5C, OpEnc::O, "4", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x5D, OpEnc::O, "5", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x5E, OpEnc::O, "6", {Operand::reg32}},
+    {Prefix::NONE, Mnemonic::POP, 0x5F, OpEnc::O, "7", {Operand::reg32}},
+
+    // PUSH
+    {Prefix::NONE, Mnemonic::PUSH, 0xFF, OpEnc::M, "6", {Operand::rm64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x50, OpEnc::O, "0", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x51, OpEnc::O, "1", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x52, OpEnc::O, "2", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x53, OpEnc::O, "3", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x54, OpEnc::O, "4", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x55, OpEnc::O, "5", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x56, OpEnc::O, "6", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x57, OpEnc::O, "7", {Operand::reg64}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x6A, OpEnc::I, "ib", {Operand::imm8}},
+    {Prefix::NONE, Mnemonic::PUSH, 0x68, OpEnc::I, "id", {Operand::imm32}},
+
+    {Prefix::NONE, Mnemonic::SAL, 0xD0, OpEnc::M1, "4",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::SAL, 0xD0, OpEnc::M1, "4",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::SAL, 0xD2, OpEnc::MC, "4",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::SAL, 0xD2, OpEnc::MC, "4",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::SAL, 0xC0, OpEnc::MI, "4",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SAL, 0xC0, OpEnc::MI, "4",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::SAL, 0xD1, OpEnc::M1, "4",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::SAL, 0xD1, OpEnc::M1, "4",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::SAL, 0xD1, OpEnc::M1, "4",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::SAL, 0xD3, OpEnc::MC, "4",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::SAL, 0xD3, OpEnc::MC, "4",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::SAL, 0xD3, OpEnc::MC, "4",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::SAL, 0xC1, OpEnc::MI, "4",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SAL, 0xC1, OpEnc::MI, "4",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SAL, 0xC1, OpEnc::MI, "4",
+     {Operand::rm64, Operand::imm8}},
+
+    {Prefix::NONE, Mnemonic::SAR, 0xD0, OpEnc::M1, "7",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::SAR, 0xD0, OpEnc::M1, "7",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::SAR, 0xD2, OpEnc::MC, "7",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::SAR, 0xD2, OpEnc::MC, "7",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::SAR, 0xC0, OpEnc::MI, "7",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SAR, 0xC0, OpEnc::MI, "7",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::SAR, 0xD1, OpEnc::M1, "7",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::SAR, 0xD1, OpEnc::M1, "7",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::SAR, 0xD1, OpEnc::M1, "7",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::SAR, 0xD3, OpEnc::MC, "7",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::SAR, 0xD3, OpEnc::MC, "7",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::SAR, 0xD3, OpEnc::MC, "7",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::SAR, 0xC1, OpEnc::MI, "7",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SAR, 0xC1, OpEnc::MI, "7",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SAR, 0xC1, OpEnc::MI, "7",
+     {Operand::rm64, Operand::imm8}},
+
+    {Prefix::NONE, Mnemonic::SHR, 0xD0, OpEnc::M1, "5",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::SHR, 0xD0, OpEnc::M1, "5",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::SHR, 0xD2, OpEnc::MC, "5",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::SHR, 0xD2, OpEnc::MC, "5",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::SHR, 0xC0, OpEnc::MI, "5",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SHR, 0xC0, OpEnc::MI, "5",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::SHR, 0xD1, OpEnc::M1, "5",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::SHR, 0xD1, OpEnc::M1, "5",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::SHR, 0xD1, OpEnc::M1, "5",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::SHR, 0xD3, OpEnc::MC, "5",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::SHR, 0xD3, OpEnc::MC, "5",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::SHR, 0xD3, OpEnc::MC, "5",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::SHR, 0xC1, OpEnc::MI, "5",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::SHR, 0xC1, OpEnc::MI, "5",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::SHR, 0xC1, OpEnc::MI, "5",
+     {Operand::rm64, Operand::imm8}},
+
+    {Prefix::NONE, Mnemonic::RCL, 0xD0, OpEnc::M1, "2",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::RCL, 0xD0, OpEnc::M1, "2",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::RCL, 0xD2, OpEnc::MC, "2",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::RCL, 0xD2, OpEnc::MC, "2",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::RCL, 0xC0, OpEnc::MI, "2",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::RCL, 0xC0, OpEnc::MI, "2",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::RCL, 0xD1, OpEnc::M1, "2",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::RCL, 0xD1, OpEnc::M1, "2",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::RCL, 0xD1, OpEnc::M1, "2",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::RCL, 0xD3, OpEnc::MC, "2",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::RCL, 0xD3, OpEnc::MC, "2",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::RCL, 0xD3, OpEnc::MC, "2",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::RCL, 0xC1, OpEnc::MI, "2",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::RCL, 0xC1, OpEnc::MI, "2",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::RCL, 0xC1, OpEnc::MI, "2",
+     {Operand::rm64, Operand::imm8}},
+
+    {Prefix::NONE, Mnemonic::RCR, 0xD0, OpEnc::M1, "3",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::RCR, 0xD0, OpEnc::M1, "3",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::RCR, 0xD2, OpEnc::MC, "3",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::RCR, 0xD2, OpEnc::MC, "3",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::RCR, 0xC0, OpEnc::MI, "3",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::RCR, 0xC0, OpEnc::MI, "3",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::RCR, 0xD1, OpEnc::M1, "3",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::RCR, 0xD1, OpEnc::M1, "3",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::RCR, 0xD1, OpEnc::M1, "3",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::RCR, 0xD3, OpEnc::MC, "3",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::RCR, 0xD3, OpEnc::MC, "3",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::RCR, 0xD3, OpEnc::MC, "3",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::RCR, 0xC1, OpEnc::MI, "3",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::RCR, 0xC1, OpEnc::MI, "3",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::RCR, 0xC1, OpEnc::MI, "3",
+     {Operand::rm64, Operand::imm8}},
+
+    {Prefix::NONE, Mnemonic::ROL, 0xD0, OpEnc::M1, "0",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::ROL, 0xD0, OpEnc::M1, "0",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::ROL, 0xD2, OpEnc::MC, "0",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::ROL, 0xD2, OpEnc::MC, "0",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::ROL, 0xC0, OpEnc::MI, "0",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ROL, 0xC0, OpEnc::MI, "0",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::ROL, 0xD1, OpEnc::M1, "0",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::ROL, 0xD1, OpEnc::M1, "0",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::ROL, 0xD1, OpEnc::M1, "0",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::ROL, 0xD3, OpEnc::MC, "0",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::ROL, 0xD3, OpEnc::MC, "0",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::ROL, 0xD3, OpEnc::MC, "0",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::ROL, 0xC1, OpEnc::MI, "0",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ROL, 0xC1, OpEnc::MI, "0",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::ROL, 0xC1, OpEnc::MI, "0",
+     {Operand::rm64, Operand::imm8}},
+
+    {Prefix::NONE, Mnemonic::ROR, 0xD0, OpEnc::M1, "1",
+     {Operand::rm8, Operand::one}},
+    {Prefix::REX, Mnemonic::ROR, 0xD0, OpEnc::M1, "1",
+     {Operand::rm8, Operand::one}},
+    {Prefix::NONE, Mnemonic::ROR, 0xD2, OpEnc::MC, "1",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::REX, Mnemonic::ROR, 0xD2, OpEnc::MC, "1",
+     {Operand::rm8, Operand::cl}},
+    {Prefix::P66, Mnemonic::ROR, 0xC0, OpEnc::MI, "1",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ROR, 0xC0, OpEnc::MI, "1",
+     {Operand::rm8, Operand::imm8}},
+    {Prefix::P66, Mnemonic::ROR, 0xD1, OpEnc::M1, "1",
+     {Operand::rm16, Operand::one}},
+    {Prefix::NONE, Mnemonic::ROR, 0xD1, OpEnc::M1, "1",
+     {Operand::rm32, Operand::one}},
+    {Prefix::REXW, Mnemonic::ROR, 0xD1, OpEnc::M1, "1",
+     {Operand::rm64, Operand::one}},
+    {Prefix::P66, Mnemonic::ROR, 0xD3, OpEnc::MC, "1",
+     {Operand::rm16, Operand::cl}},
+    {Prefix::NONE, Mnemonic::ROR, 0xD3, OpEnc::MC, "1",
+     {Operand::rm32, Operand::cl}},
+    {Prefix::REXW, Mnemonic::ROR, 0xD3, OpEnc::MC, "1",
+     {Operand::rm64, Operand::cl}},
+    {Prefix::P66, Mnemonic::ROR, 0xC1, OpEnc::MI, "1",
+     {Operand::rm16, Operand::imm8}},
+    {Prefix::NONE, Mnemonic::ROR, 0xC1, OpEnc::MI, "1",
+     {Operand::rm32, Operand::imm8}},
+    {Prefix::REXW, Mnemonic::ROR, 0xC1, OpEnc::MI, "1",
+     {Operand::rm64, Operand::imm8}},
+};
+
+/**
+ * @brief Opcode maps. The two-byte opcodes are indexed by their second byte
+ * within the map of their escape byte.
+ */
+enum OpcodeMap {
+    ONE_BYTE_MAP,
+    MAP_0F,
+    MAP_D8,
+    MAP_D9,
+    MAP_DC,
+    NUM_OPCODE_MAPS
+};
+
+constexpr int NUM_PREFIXES = 4;
+constexpr int NUM_REGS = 8;
+
+/**
+ * @brief Returns the opcode map introduced by the given escape byte.
+ * @param byte The first opcode byte.
+ * @return The opcode map, or ONE_BYTE_MAP if the byte is not an escape byte.
+ */
+constexpr OpcodeMap twoByteOpcodeMap(int byte) {
+    switch (byte) {
+        case 0x0F:
+            return MAP_0F;
+        case 0xD8:
+            return MAP_D8;
+        case 0xD9:
+            return MAP_D9;
+        case 0xDC:
+            return MAP_DC;
+        default:
+            return ONE_BYTE_MAP;
+    }
+}
+
+/**
+ * @struct OpcodeCell
+ * @brief The mnemonic and the operand entry of an opcode for one reg of ModRM.
+ */
+struct OpcodeCell {
+    Mnemonic mnemonic;  /**< Mnemonic::INVALID if the reg is undefined */
+    int16_t operandIdx; /**< Index into OPERAND_ENTRIES, or -1 */
+};
+
+/**
+ * @struct OpcodeSlot
+ * @brief All the information about a (prefix, opcode) pair.
+ */
+struct OpcodeSlot {
+    bool present;  /**< Whether the opcode is defined for the prefix */
+    Prefix prefix; /**< The prefix after falling back (REX.W -> REX -> none) */
+    OpcodeCell regs[NUM_REGS];
+};
+
+/**
+ * @struct OpcodeTable
+ * @brief Dense (prefix x opcode map x opcode byte x reg) table built from
+ * OP_ENTRIES and OPERAND_ENTRIES at compile time, so that a lookup is a
+ * couple of array accesses.
+ */
+struct OpcodeTable {
+    OpcodeSlot slots[NUM_PREFIXES][NUM_OPCODE_MAPS][256];
+
+    constexpr OpcodeTable() : slots{} {
+        for (auto& prefixSlots : slots) {
+            for (auto& mapSlots : prefixSlots) {
+                for (OpcodeSlot& slot : mapSlots) {
+                    for (OpcodeCell& cell : slot.regs) {
+                        cell = {Mnemonic::INVALID, -1};
+                    }
+                }
+            }
+        }
+
+        // (prefix, opcode) -> (reg -> operator); the first entry wins
+        Mnemonic anyReg[NUM_PREFIXES][NUM_OPCODE_MAPS][256] = {};
+        for (auto& prefixAnyReg : anyReg) {
+            for (auto& mapAnyReg : prefixAnyReg) {
+                for (Mnemonic& m : mapAnyReg) {
+                    m = Mnemonic::INVALID;
+                }
+            }
+        }
+        for (const OpcodeEntry& e : OP_ENTRIES) {
+            OpcodeSlot& slot = mutableAt(e.prefix, e.opcode);
+            slot.present = true;
+            slot.prefix = e.prefix;
+            if (e.reg < 0) {
+                Mnemonic& m = anyReg[static_cast<int>(e.prefix)]
+                                    [twoByteOpcodeMap(e.opcode >> 8)]
+                                    [e.opcode & 0xFF];
+                if (m == Mnemonic::INVALID) {
+                    m = e.mnemonic;
+                }
+            } else if (slot.regs[e.reg].mnemonic == Mnemonic::INVALID) {
+                slot.regs[e.reg].mnemonic = e.mnemonic;
+            }
+        }
+        for (int p = 0; p < NUM_PREFIXES; p++) {
+            for (int map = 0; map < NUM_OPCODE_MAPS; map++) {
+                for (int byte = 0; byte < 256; byte++) {
+                    for (OpcodeCell& cell : slots[p][map][byte].regs) {
+                        if (cell.mnemonic == Mnemonic::INVALID) {
+                            cell.mnemonic = anyReg[p][map][byte];
+                        }
+                    }
+                }
+            }
+        }
+
+        // (prefix, operator, opcode) -> operands; the first entry wins
+        for (int idx = 0; idx < static_cast<int>(sizeof(OPERAND_ENTRIES) /
+                                                 sizeof(OPERAND_ENTRIES[0]));
+             idx++) {
+            const OperandEntry& e = OPERAND_ENTRIES[idx];
+            for (OpcodeCell& cell : mutableAt(e.prefix, e.opcode).regs) {
+                if (cell.mnemonic == e.mnemonic && cell.operandIdx < 0) {
+                    cell.operandIdx = static_cast<int16_t>(idx);
+                }
+            }
+        }
+
+        // REX.W falls back to REX, and REX falls back to no prefix
+        for (int map = 0; map < NUM_OPCODE_MAPS; map++) {
+            for (int byte = 0; byte < 256; byte++) {
+                fallback(Prefix::REXW, Prefix::REX, map, byte);
+                fallback(Prefix::REX, Prefix::NONE, map, byte);
+            }
+        }
+    }
+
+    /**
+     * @brief Looks up the slot of the given prefix and opcode.
+     * @param prefix The prefix.
+     * @param opcode The one-byte or two-byte opcode.
+     * @return The slot.
+     */
+    constexpr const OpcodeSlot& at(Prefix prefix, int opcode) const {
+        return slots[static_cast<int>(prefix)][twoByteOpcodeMap(opcode >> 8)]
+                    [opcode & 0xFF];
+    }
+
+   private:
+    constexpr OpcodeSlot& mutableAt(Prefix prefix, int opcode) {
+        return slots[static_cast<int>(prefix)][twoByteOpcodeMap(opcode >> 8)]
+                    [opcode & 0xFF];
+    }
+
+    constexpr void fallback(Prefix from, Prefix to, int map, int byte) {
+        OpcodeSlot& src = slots[static_cast<int>(from)][map][byte];
+        const OpcodeSlot& dst = slots[static_cast<int>(to)][map][byte];
+        if (!src.present && dst.present) {
+            src = dst;
+        }
+    }
+};
+
+inline constexpr OpcodeTable OP_TABLE{};
+
+/**
+ * @brief The maximum length of an x86 instruction.
+ */
+constexpr int MAX_INSTRUCTION_LENGTH = 15;
+
+/**
+ * @brief Bits of the prefix bitmask, one per legacy prefix byte.
+ */
+enum PrefixBit : uint16_t {
+    PREFIX_LOCK = 1 << 0,    /**< F0 */
+    PREFIX_REPNE = 1 << 1,   /**< F2 */
+    PREFIX_REP = 1 << 2,     /**< F3 */
+    PREFIX_CS = 1 << 3,      /**< 2E */
+    PREFIX_SS = 1 << 4,      /**< 36 */
+    PREFIX_DS = 1 << 5,      /**< 3E (notrack for indirect branches) */
+    PREFIX_ES = 1 << 6,      /**< 26 */
+    PREFIX_FS = 1 << 7,      /**< 64 */
+    PREFIX_GS = 1 << 8,      /**< 65 */
+    PREFIX_OPSIZE = 1 << 9,  /**< 66 */
+    PREFIX_REX = 1 << 10,    /**< 40-4F; not a legacy prefix */
+};
+
+/**
+ * @brief The bits of the legacy prefixes.
+ */
+constexpr uint16_t LEGACY_PREFIX_MASK = PREFIX_REX - 1;
+
+/**
+ * @struct ByteClassTable
+ * @brief Maps every byte to its prefix bit, or 0 if the byte is not a
+ * prefix. The address-size prefix (67) is not supported and is left as 0.
+ */
+struct ByteClassTable {
+    uint16_t classes[256];
+
+    constexpr ByteClassTable() : classes{} {
+        classes[0xF0] = PREFIX_LOCK;
+        classes[0xF2] = PREFIX_REPNE;
+        classes[0xF3] = PREFIX_REP;
+        classes[0x2E] = PREFIX_CS;
+        classes[0x36] = PREFIX_SS;
+        classes[0x3E] = PREFIX_DS;
+        classes[0x26] = PREFIX_ES;
+        classes[0x64] = PREFIX_FS;
+        classes[0x65] = PREFIX_GS;
+        classes[0x66] = PREFIX_OPSIZE;
+        for (int byte = 0x40; byte <= 0x4F; byte++) {
+            classes[byte] = PREFIX_REX;
+        }
+    }
+
+    constexpr uint16_t operator[](int byte) const { return classes[byte]; }
 };
 
-const std::vector<std::pair<int, int>> MULTI_BYTES_OPCODES = {
-    std::make_pair(4, u2d("\xF3\x0F\x1E\xFA")),
-    std::make_pair(4, u2d("\xF3\x0F\x1E\xFB"))};
+inline constexpr ByteClassTable BYTE_CLASS{};
@@ -0,0 +1,115 @@
+/**
+ * @file
+ * @brief Defines the per-thread work-stealing worklists of the parallel
+ * recursive descent.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @struct WorkStealingQueues
+ * @brief One deque of addresses per thread. A thread pushes and pops at the
+ * back of its own deque (depth first, like the sequential worklist) and
+ * steals from the front of the others when its own runs dry.
+ */
+struct WorkStealingQueues {
+    /**
+     * @brief Constructor for WorkStealingQueues.
+     * @param numThreads The number of threads.
+     */
+    explicit WorkStealingQueues(size_t numThreads)
+        : numThreads(numThreads), queues(new Queue[numThreads]) {}
+
+    /**
+     * @brief Adds a task to the deque of a thread.
+     * @param tid The index of the thread.
+     * @param addr The address to explore.
+     */
+    void push(size_t tid, uint64_t addr) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(queues[tid].mutex);
+        queues[tid].tasks.push_back(addr);
+    }
+
+    /**
+     * @brief Takes a task from the deque of a thread, or steals one from
+     * another thread.
+     * @param tid The index of the thread.
+     * @param addr The address to explore.
+     * @return True if a task was taken.
+     */
+    bool pop(size_t tid, uint64_t &addr) {
+        {
+            std::lock_guard<std::mutex> lock(queues[tid].mutex);
+            if (!queues[tid].tasks.empty()) {
+                addr = queues[tid].tasks.back();
+                queues[tid].tasks.pop_back();
+                return true;
+            }
+        }
+        for (size_t i = 1; i < numThreads; i++) {
+            Queue &victim = queues[(tid + i) % numThreads];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                addr = victim.tasks.front();
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Marks a task taken by pop as finished. Tasks pushed while
+     * running it must be pushed before this call.
+     */
+    void finish() { pending.fetch_sub(1, std::memory_order_acq_rel); }
+
+    /**
+     * @brief Checks whether all tasks have finished.
+     * @return True if no task is queued or running.
+     */
+    bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+    /**
+     * @brief Runs explore(tid, addr) for every task on its own thread until
+     * all tasks have finished.
+     * @param tid The index of the thread.
+     * @param explore The function that explores an address.
+     */
+    template <typename F>
+    void run(size_t tid, F explore) {
+        uint64_t addr;
+        while (true) {
+            if (pop(tid, addr)) {
+                explore(tid, addr);
+                finish();
+            } else if (done()) {
+                return;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+   private:
+    /**
+     * @struct Queue
+     * @brief The deque of one thread.
+     */
+    struct Queue {
+        std::mutex mutex;           /**< Guards tasks */
+        std::deque<uint64_t> tasks; /**< The addresses to explore */
+    };
+
+    size_t numThreads;               /**< The number of threads */
+    std::unique_ptr<Queue[]> queues; /**< The deque of each thread */
+    std::atomic<size_t> pending{0};  /**< Tasks queued or running */
+};
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "state.h"
+
+static std::atomic<size_t> numAllocations(0);
+
+void* operator new(size_t size) {
+    numAllocations++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+
+TEST(allocation, DECODE_DOES_NOT_ALLOCATE) {
+    const std::vector<unsigned char> instructions = {
+        0xf3, 0x0f, 0x1e, 0xfa,  // endbr64
+        0x55,                    // push rbp
+        0x48, 0x89, 0xe5,        // mov rbp rsp
+        0x8b, 0x54, 0x88, 0xf0,  // mov edx [rax + rcx * 4 - 0x10]
+        0x44, 0x01, 0x04, 0x91,  // add [rcx + rdx * 4] r8d
+        0x8b, 0x0c, 0x25, 0x00,
+        0x00, 0x08, 0x00,  // mov ecx 0x00080000
+        0x48, 0xb8, 0x88, 0x77, 0x66,
+        0x55, 0x44, 0x33, 0x22, 0x11,  // mov rax 0x1122334455667788
+        0x0f, 0xaf, 0xc3,              // imul eax ebx
+        0x83, 0xf8, 0x01,              // cmp eax 0x01
+        0x74, 0x02,                    // jz
+        0xe8, 0x07, 0x00, 0x00, 0x00,  // call
+        0xf3, 0x48, 0xab,              // rep stosq
+        0xc9,                          // leave
+        0xc3,                          // ret
+    };
+
+    // about a million instructions
+    std::vector<unsigned char> corpus;
+    for (int i = 0; i < 80000; i++) {
+        corpus.insert(corpus.end(), instructions.begin(), instructions.end());
+    }
+
+    size_t numInstructions = 0;
+    size_t before = numAllocations.load();
+    for (uint64_t addr = 0; addr < corpus.size();) {
+        State state(corpus);
+        DecodedInstruction instruction = state.step(addr);
+        addr = instruction.nextAddr();
+        numInstructions++;
+    }
+    size_t after = numAllocations.load();
+
+    ASSERT_EQ(numInstructions, 80000 * 14);
+    ASSERT_LE(after - before, 16);
+}
@@ -10,8 +10,9 @@
 #include <vector>
 
 #include "disassembler.h"
+#include "length.h"
 
-const std::unordered_map<uint64_t, std::string> addr2symbol;
+const SymbolIndex addr2symbol;
 
 TEST(disas, ONE_BYTE) {
     std::vector<unsigned char> obj = {
@@ -22,11 +23,11 @@ TEST(disas, ONE_BYTE) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 1)], "nop ");
+    ASSERT_EQ(disas.instructions.text(0, 1), "nop ");
 
     disas.curAddr = 1;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(1, 2)], "ret ");
+    ASSERT_EQ(disas.instructions.text(1, 2), "ret ");
 }
 
 TEST(disas, ONE_BYTE_IMM) {
@@ -40,22 +41,22 @@ TEST(disas, ONE_BYTE_IMM) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 5)],
+    ASSERT_EQ(disas.instructions.text(0, 5),
               "mov  eax 0x11223344");
 
     disas.curAddr = 5;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(5, 10)],
+    ASSERT_EQ(disas.instructions.text(5, 10),
               "mov  ecx 0x11223344");
 
     disas.curAddr = 10;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(10, 15)],
+    ASSERT_EQ(disas.instructions.text(10, 15),
               "add  eax 0x11223344");
 
     disas.curAddr = 15;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(15, 20)],
+    ASSERT_EQ(disas.instructions.text(15, 20),
               "sub  eax 0x11223344");
 }
 
@@ -71,22 +72,22 @@ TEST(disas, ONE_BYTE_IMM_SIZE) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 2)],
+    ASSERT_EQ(disas.instructions.text(0, 2),
               "mov  al 0x11");
 
     disas.curAddr = 2;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(2, 6)],
+    ASSERT_EQ(disas.instructions.text(2, 6),
               "mov  ax 0x1122");
 
     disas.curAddr = 6;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(6, 11)],
+    ASSERT_EQ(disas.instructions.text(6, 11),
               "mov  eax 0x11223344");
 
     disas.curAddr = 11;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(11, 21)],
+    ASSERT_EQ(disas.instructions.text(11, 21),
               "mov  rax 0x1122334455667788");
 }
 
@@ -105,7 +106,7 @@ TEST(disas, SEVERAL_ADD) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 2)],
+    ASSERT_EQ(disas.instructions.text(0, 2),
               "add  ecx eax");
 
     disas.curAddr = 2;
@@ -113,22 +114,22 @@ TEST(disas, SEVERAL_ADD) {
 
     disas.curAddr = 9;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(9, 11)],
+    ASSERT_EQ(disas.instructions.text(9, 11),
               "add  [rax] eax");
 
     disas.curAddr = 11;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(11, 14)],
+    ASSERT_EQ(disas.instructions.text(11, 14),
               "add  [rax + rax * 1] eax");
 
     disas.curAddr = 14;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(14, 18)],
+    ASSERT_EQ(disas.instructions.text(14, 18),
               "add  [rax + rax * 1 + 0x1] eax");
 
     disas.curAddr = 18;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(18, 25)],
+    ASSERT_EQ(disas.instructions.text(18, 25),
               "add  [rax + rax * 1 + 0x00008000] eax");
 }
 
@@ -147,42 +148,42 @@ TEST(disas, MODRM_REG) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 2)],
+    ASSERT_EQ(disas.instructions.text(0, 2),
               "add  [rax] eax");
 
     disas.curAddr = 2;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(2, 4)],
+    ASSERT_EQ(disas.instructions.text(2, 4),
               "add  [rax] ecx");
 
     disas.curAddr = 4;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(4, 6)],
+    ASSERT_EQ(disas.instructions.text(4, 6),
               "add  [rax] edx");
 
     disas.curAddr = 6;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(6, 8)],
+    ASSERT_EQ(disas.instructions.text(6, 8),
               "add  [rax] ebx");
 
     disas.curAddr = 8;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(8, 10)],
+    ASSERT_EQ(disas.instructions.text(8, 10),
               "add  [rax] esp");
 
     disas.curAddr = 10;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(10, 12)],
+    ASSERT_EQ(disas.instructions.text(10, 12),
               "add  [rax] ebp");
 
     disas.curAddr = 12;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(12, 14)],
+    ASSERT_EQ(disas.instructions.text(12, 14),
               "add  [rax] esi");
 
     disas.curAddr = 14;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(14, 16)],
+    ASSERT_EQ(disas.instructions.text(14, 16),
               "add  [rax] edi");
 }
 
@@ -200,47 +201,47 @@ TEST(disas, MODRM_MOD11) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 2)],
+    ASSERT_EQ(disas.instructions.text(0, 2),
               "add  eax eax");
 
     disas.curAddr = 2;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(2, 4)],
+    ASSERT_EQ(disas.instructions.text(2, 4),
               "add  ecx eax");
 
     disas.curAddr = 4;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(4, 6)],
+    ASSERT_EQ(disas.instructions.text(4, 6),
               "add  edx eax");
 
     disas.curAddr = 6;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(6, 8)],
+    ASSERT_EQ(disas.instructions.text(6, 8),
               "add  ebx eax");
 
     disas.curAddr = 8;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(8, 10)],
+    ASSERT_EQ(disas.instructions.text(8, 10),
               "add  esp eax");
 
     disas.curAddr = 10;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(10, 12)],
+    ASSERT_EQ(disas.instructions.text(10, 12),
               "add  ebp eax");
 
     disas.curAddr = 12;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(12, 14)],
+    ASSERT_EQ(disas.instructions.text(12, 14),
               "add  esi eax");
 
     disas.curAddr = 14;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(14, 16)],
+    ASSERT_EQ(disas.instructions.text(14, 16),
               "add  edi eax");
 
     disas.curAddr = 16;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(16, 18)],
+    ASSERT_EQ(disas.instructions.text(16, 18),
               "add  eax eax");
 }
 
@@ -254,17 +255,17 @@ TEST(disas, MODRM_MOD_DISP) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 2)],
+    ASSERT_EQ(disas.instructions.text(0, 2),
               "mov  ecx [rax]");
 
     disas.curAddr = 2;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(2, 5)],
+    ASSERT_EQ(disas.instructions.text(2, 5),
               "mov  ecx [rax + 0x1]");
 
     disas.curAddr = 5;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(5, 11)],
+    ASSERT_EQ(disas.instructions.text(5, 11),
               "mov  ecx [rax + 0x00000100]");
 }
 
@@ -273,29 +274,35 @@ TEST(disas, MODRM_MOD00_RM101) {
         0x8b, 0x4d, 0x00,                         // mov ecx [rbp + 0x0]
         0x8b, 0x4d, 0x01,                         // mov ecx [rbp + 0x1]
         0x8b, 0x8d, 0x00, 0x01, 0x00, 0x00,       // mov ecx [rbp + 0x00000100]
-        0x8b, 0x0c, 0x25, 0x00, 0x00, 0x08, 0x00  // mov ecx 0x00080000
+        0x8b, 0x0c, 0x25, 0x00, 0x00, 0x08, 0x00, // mov ecx 0x00080000
+        0x8b, 0x0c, 0x25, 0xf0, 0xff, 0xff, 0xff  // mov ecx -0x10
     };
     LinearSweepDisAssembler disas(obj, addr2symbol);
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 3)],
+    ASSERT_EQ(disas.instructions.text(0, 3),
               "mov  ecx [rbp + 0x0]");
 
     disas.curAddr = 3;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(3, 6)],
+    ASSERT_EQ(disas.instructions.text(3, 6),
               "mov  ecx [rbp + 0x1]");
 
     disas.curAddr = 6;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(6, 12)],
+    ASSERT_EQ(disas.instructions.text(6, 12),
               "mov  ecx [rbp + 0x00000100]");
 
     disas.curAddr = 12;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(12, 19)],
+    ASSERT_EQ(disas.instructions.text(12, 19),
               "mov  ecx 0x00080000");
+
+    disas.curAddr = 19;
+    disas.step();
+    ASSERT_EQ(disas.instructions.text(19, 26),
+              "mov  ecx -0x10");
 }
 
 TEST(disas, MODRM_SIB_RSP) {
@@ -309,22 +316,22 @@ TEST(disas, MODRM_SIB_RSP) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 3)],
+    ASSERT_EQ(disas.instructions.text(0, 3),
               "mov  edx [rax + rcx * 1]");
 
     disas.curAddr = 3;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(3, 7)],
+    ASSERT_EQ(disas.instructions.text(3, 7),
               "mov  edx [rax + rcx * 1 + 0x1]");
 
     disas.curAddr = 7;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(7, 10)],
+    ASSERT_EQ(disas.instructions.text(7, 10),
               "mov  edx [rax + rcx * 2]");
 
     disas.curAddr = 10;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(10, 13)],
+    ASSERT_EQ(disas.instructions.text(10, 13),
               "mov  edx [rsp]");
 }
 
@@ -337,13 +344,13 @@ TEST(disas, ADD_IMM) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 2)],
+    ASSERT_EQ(disas.instructions.text(0, 2),
               "add  eax eax");
 
     disas.curAddr = 2;
 
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(2, 5)],
+    ASSERT_EQ(disas.instructions.text(2, 5),
               "add  eax 0x01");
 }
 
@@ -362,42 +369,42 @@ TEST(disas, MODRM_OPCODE) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 3)],
+    ASSERT_EQ(disas.instructions.text(0, 3),
               "add  eax 0x01");
 
     disas.curAddr = 3;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(3, 6)],
+    ASSERT_EQ(disas.instructions.text(3, 6),
               "or  eax 0x01");
 
     disas.curAddr = 6;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(6, 9)],
+    ASSERT_EQ(disas.instructions.text(6, 9),
               "adc  eax 0x01");
 
     disas.curAddr = 9;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(9, 12)],
+    ASSERT_EQ(disas.instructions.text(9, 12),
               "sbb  eax 0x01");
 
     disas.curAddr = 12;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(12, 15)],
+    ASSERT_EQ(disas.instructions.text(12, 15),
               "and  eax 0x01");
 
     disas.curAddr = 15;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(15, 18)],
+    ASSERT_EQ(disas.instructions.text(15, 18),
               "sub  eax 0x01");
 
     disas.curAddr = 18;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(18, 21)],
+    ASSERT_EQ(disas.instructions.text(18, 21),
               "xor  eax 0x01");
 
     disas.curAddr = 21;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(21, 24)],
+    ASSERT_EQ(disas.instructions.text(21, 24),
               "cmp  eax 0x01");
 }
 
@@ -410,12 +417,12 @@ TEST(disas, REXW) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 3)],
+    ASSERT_EQ(disas.instructions.text(0, 3),
               "add  eax 0x01");
 
     disas.curAddr = 3;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(3, 7)],
+    ASSERT_EQ(disas.instructions.text(3, 7),
               "add  rax 0x01");
 }
 
@@ -429,17 +436,17 @@ TEST(disas, REXRXB) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 4)],
+    ASSERT_EQ(disas.instructions.text(0, 4),
               "add  [rcx + rdx * 4] r8d");
 
     disas.curAddr = 4;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(4, 8)],
+    ASSERT_EQ(disas.instructions.text(4, 8),
               "add  [rcx + r10 * 4] eax");
 
     disas.curAddr = 8;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(8, 12)],
+    ASSERT_EQ(disas.instructions.text(8, 12),
               "add  [r9 + rdx * 4] eax");
 }
 
@@ -454,17 +461,17 @@ TEST(disas, TWOBYTE) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 3)],
+    ASSERT_EQ(disas.instructions.text(0, 3),
               "imul  eax ebx");
 
     disas.curAddr = 3;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(3, 12)],
+    ASSERT_EQ(disas.instructions.text(3, 12),
               "movsx  rax 0x00000000");
 
     disas.curAddr = 12;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(12, 15)],
+    ASSERT_EQ(disas.instructions.text(12, 15),
               "movsxd  rax ebx");
 }
 
@@ -479,22 +486,489 @@ TEST(disas, CFInstructions) {
 
     disas.curAddr = 0;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(0, 5)],
+    ASSERT_EQ(disas.instructions.text(0, 5),
               "call c ; relative offset = 7");
 
     disas.curAddr = 5;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(5, 7)],
+    ASSERT_EQ(disas.instructions.text(5, 7),
               "jz 9 ; relative offset = 2");
 
     disas.curAddr = 7;
     disas.step();
-    ASSERT_EQ(disas.disassembledInstructions[std::make_pair(7, 9)],
+    ASSERT_EQ(disas.instructions.text(7, 9),
               "jmp d ; relative offset = 4");
 
     // disas.curAddr = 9;
     // disas.step();
-    // ASSERT_EQ(disas.disassembledInstructions[std::make_pair(9, 11)],
+    // ASSERT_EQ(disas.instructions.text(9, 11),
     //           "jmp -3 ; relative offset = -14");
 }
 
+
+TEST(disas, DECODED_INSTRUCTION) {
+    std::vector<unsigned char> obj = {
+        0x8b, 0x54, 0x88, 0xf0,  // mov edx [rax + rcx * 4 - 0x10]
+        0x74, 0xfa,              // jz 0
+    };
+    State state(obj);
+
+    DecodedInstruction mov = state.step(0);
+    ASSERT_EQ(mov.length, 4);
+    ASSERT_EQ(mov.mnemonic, Mnemonic::MOV);
+    ASSERT_EQ(mov.numOperands, 2);
+    ASSERT_EQ(mov.operands[0].kind, Operand::reg32);
+    ASSERT_EQ(mov.operands[0].reg, 2);
+    ASSERT_EQ(mov.base, 0);
+    ASSERT_EQ(mov.index, 1);
+    ASSERT_EQ(mov.scale, 4);
+    ASSERT_EQ(mov.disp, -0x10);
+    ASSERT_EQ(formatInstruction(mov, addr2symbol),
+              "mov  edx [rax + rcx * 4 - 0x10]");
+
+    State state2(obj);
+    DecodedInstruction jz = state2.step(4);
+    ASSERT_EQ(jz.length, 2);
+    ASSERT_TRUE(jz.hasRelativeTarget());
+    ASSERT_EQ(jz.relativeOffset(), -6);
+    ASSERT_EQ(jz.branchTarget(), 0);
+}
+
+TEST(disas, LENGTH_DECODER) {
+    std::vector<unsigned char> obj = {
+        0xf3, 0x0f, 0x1e, 0xfa,                    // endbr64
+        0x8b, 0x54, 0x88, 0xf0,                    // mov edx [rax + ...]
+        0x48, 0x81, 0x84, 0x24, 0x10, 0x00, 0x00,  // add [rsp + 0x10] ...
+        0x00, 0x44, 0x33, 0x22, 0x11,              // ... 0x11223344
+        0x0f, 0x84, 0x10, 0x00, 0x00, 0x00,        // jz
+        0xe2, 0xfe,                                // loop
+        0xff, 0x25, 0x00, 0x00, 0x00, 0x00,        // jmp [rip + 0x0]
+        0xe8, 0x00, 0x00, 0x00, 0x00,              // call
+        0xc3,                                      // ret
+        0x0f, 0x0b,                                // ud2 (unknown)
+        0xb8, 0x44, 0x33,                          // truncated mov
+    };
+    std::vector<std::pair<int, FlowClass>> expected = {
+        {4, FlowClass::FALLTHROUGH}, {4, FlowClass::FALLTHROUGH},
+        {12, FlowClass::FALLTHROUGH}, {6, FlowClass::JCC},
+        {2, FlowClass::JCC},          {6, FlowClass::JMP},
+        {5, FlowClass::CALL},         {1, FlowClass::RET},
+    };
+
+    uint64_t addr = 0;
+    for (const auto& e : expected) {
+        InstructionLength len = decodeLength(obj, addr);
+        ASSERT_EQ(len.length, e.first);
+        ASSERT_EQ(len.flow, e.second);
+        State state(obj);
+        ASSERT_EQ(state.step(addr).length, len.length);
+        addr += len.length;
+    }
+    ASSERT_EQ(decodeLength(obj, addr).flow, FlowClass::INVALID);
+    ASSERT_EQ(decodeLength(obj, addr + 2).flow, FlowClass::INVALID);
+    ASSERT_EQ(decodeLength(obj, obj.size()).flow, FlowClass::INVALID);
+}
+
+TEST(disas, DECODE_STATUS) {
+    std::vector<unsigned char> obj = {
+        0x0f, 0x0b,        // ud2 (unknown)
+        0x90,              // nop
+        0xb8, 0x44, 0x33,  // truncated mov
+    };
+    State state(obj);
+    DecodedInstruction ud2 = state.step(0);
+    ASSERT_EQ(ud2.status, DecodeStatus::UNKNOWN_OPCODE);
+    ASSERT_EQ(ud2.opcode, 0x0f);
+
+    State state2(obj);
+    ASSERT_EQ(state2.step(3).status, DecodeStatus::TRUNCATED);
+
+    LinearSweepDisAssembler disas(obj, addr2symbol);
+    disas.disas(0, obj.size() - 1);
+    ASSERT_EQ(disas.instructions.text(2, 3), "nop ");
+    ASSERT_EQ(disas.errorReport.total, 5);
+    const DecodeErrorReport::Entry& entry = disas.errorReport.entries.at(
+        std::make_tuple(DecodeStatus::UNKNOWN_OPCODE, Prefix::NONE, 0x0f));
+    ASSERT_EQ(entry.count, 1);
+    ASSERT_EQ(entry.addrs, std::vector<uint64_t>({0}));
+}
+
+TEST(disas, LEGACY_PREFIXES) {
+    std::vector<unsigned char> obj = {
+        0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00,
+        0x00, 0x00, 0x00, 0x00,              // cs nop [rax + rax * 1 + 0x0]
+        0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84,
+        0x00, 0x00, 0x00, 0x00, 0x00,        // data16 cs nop ...
+        0x66, 0x90,                          // nop
+        0x64, 0xf3, 0x48, 0xab,              // rep stosq (fs)
+    };
+    LinearSweepDisAssembler disas(obj, addr2symbol);
+    disas.disas(0, obj.size() - 1);
+
+    ASSERT_TRUE(disas.errorReport.empty());
+    ASSERT_EQ(disas.instructions.text(0, 10),
+              "nop  [rax + rax * 1 + 0x00000000]");
+    ASSERT_EQ(disas.instructions.text(10, 21),
+              "nop  [rax + rax * 1 + 0x00000000]");
+    ASSERT_EQ(disas.instructions.text(21, 23), "nop ");
+    ASSERT_EQ(disas.instructions.text(23, 27),
+              "rep stosq ");
+
+    State state(obj);
+    DecodedInstruction nop = state.step(10);
+    ASSERT_EQ(nop.legacyPrefixes, PREFIX_OPSIZE | PREFIX_CS);
+    ASSERT_EQ(decodeLength(obj, 10).length, 11);
+}
+
+TEST(disas, MAX_INSTRUCTION_LENGTH) {
+    // 14 cs prefixes before a 5-byte mov make a 19-byte instruction
+    std::vector<unsigned char> obj(14, 0x2e);
+    obj.insert(obj.end(), {0xb8, 0x44, 0x33, 0x22, 0x11});
+    // 10 cs prefixes before it are exactly 15 bytes
+    size_t longest = obj.size();
+    obj.insert(obj.end(), 10, 0x2e);
+    obj.insert(obj.end(), {0xb8, 0x44, 0x33, 0x22, 0x11});
+
+    State state(obj);
+    ASSERT_EQ(state.step(0).status, DecodeStatus::TOO_LONG);
+    ASSERT_EQ(decodeLength(obj, 0).flow, FlowClass::INVALID);
+
+    State state2(obj);
+    DecodedInstruction mov = state2.step(longest);
+    ASSERT_EQ(mov.status, DecodeStatus::OK);
+    ASSERT_EQ(mov.length, MAX_INSTRUCTION_LENGTH);
+    ASSERT_EQ(decodeLength(obj, longest).length, MAX_INSTRUCTION_LENGTH);
+}
+
+TEST(disas, DECODE_BLOCK) {
+    std::vector<unsigned char> obj = {
+        0x55,                    // push rbp
+        0x48, 0x89, 0xe5,        // mov rbp rsp
+        0x06,                    // (invalid in 64-bit mode)
+        0x74, 0xfb,              // jz
+        0xc3,                    // ret
+    };
+    DecodedInstruction out[8];
+    size_t n = decodeBlock(obj.data(), obj.data() + obj.size(), 0x1000, out,
+                           8);
+    ASSERT_EQ(n, 5);
+    ASSERT_EQ(out[0].startAddr, 0x1000);
+    ASSERT_EQ(out[1].mnemonic, Mnemonic::MOV);
+    ASSERT_EQ(out[2].status, DecodeStatus::UNKNOWN_OPCODE);
+    ASSERT_EQ(out[2].length, 1);
+    ASSERT_EQ(out[3].startAddr, 0x1005);
+    ASSERT_EQ(out[3].branchTarget(), 0x1002);
+    ASSERT_EQ(out[4].mnemonic, Mnemonic::RET);
+
+    // stops when the array is full
+    ASSERT_EQ(decodeBlock(obj.data(), obj.data() + obj.size(), 0, out, 2), 2);
+}
+
+TEST(disas, CLAMP_TO_SECTION_END) {
+    std::vector<unsigned char> obj = {
+        0x90,                          // nop
+        0xb8, 0x44, 0x33, 0x22, 0x11,  // mov eax 0x11223344
+    };
+    obj.resize(obj.size() + 2 * MAX_DECODE_READ, 0);
+
+    // the mov crosses the end of the range [0, 2]
+    LinearSweepDisAssembler disas(obj, addr2symbol);
+    disas.disas(0, 2);
+    ASSERT_EQ(disas.instructions.text(0, 1), "nop ");
+    ASSERT_EQ(disas.instructions.size(), 1);
+    ASSERT_EQ(disas.errorReport.entries.begin()->first,
+              std::make_tuple(DecodeStatus::TRUNCATED, Prefix::NONE, 0xb8));
+
+    // within DECODE_PADDING bytes of the end, step takes the checked path,
+    // which reports the truncation and keeps the length within the end
+    State state(obj.data(), obj.data() + 3, true);
+    ASSERT_EQ(state.step(1).status, DecodeStatus::TRUNCATED);
+    State state2(obj.data(), obj.data() + 6, true);
+    ASSERT_EQ(state2.step(1).length, 5);
+}
+
+TEST(disas, FAST_PATH_MATCHES_CHECKED_PATH) {
+    std::vector<unsigned char> obj = {
+        0x90,                                // nop
+        0x48, 0xb8, 0x88, 0x77, 0x66, 0x55,  // mov rax 0x1122334455667788
+        0x44, 0x33, 0x22, 0x11,
+        0x48, 0x8d, 0x84, 0x88, 0x78, 0x56,  // lea rax [rax+rcx*4+0x12345678]
+        0x34, 0x12,
+        0x81, 0xc3, 0x78, 0x56, 0x34, 0x12,  // add ebx 0x12345678
+        0x41, 0x57,                          // push r15
+        0xe8, 0x00, 0x00, 0x00, 0x00,        // call 32
+        0xc3,                                // ret
+    };
+    size_t codeSize = obj.size();
+    obj.resize(codeSize + MAX_DECODE_READ + DECODE_PADDING, 0);
+    const unsigned char *end = obj.data() + obj.size() - DECODE_PADDING;
+
+    // every start, including those inside instructions, has at least
+    // DECODE_PADDING bytes left, so the padded state takes the fast path
+    for (uint64_t addr = 0; addr < codeSize; addr++) {
+        ASSERT_GE(end - obj.data() - addr, DECODE_PADDING);
+        DecodedInstruction fast = State(obj.data(), end, true).step(addr);
+        DecodedInstruction checked =
+            State(obj.data(), end, false).step(addr);
+
+        ASSERT_EQ(fast.status, checked.status);
+        ASSERT_EQ(fast.length, checked.length);
+        ASSERT_EQ(fast.prefix, checked.prefix);
+        ASSERT_EQ(fast.opcode, checked.opcode);
+        if (fast.status == DecodeStatus::OK) {
+            ASSERT_EQ(formatInstruction(fast, addr2symbol),
+                      formatInstruction(checked, addr2symbol));
+        }
+    }
+}
+
+TEST(disas, INSTRUCTION_STORE) {
+    InstructionStore store;
+    store.add(4, 6, "b");
+    store.add(0, 2, "a");
+    store.add(4, 6, "c");  // replaces "b"
+    store.add(8, 9, "d");
+
+    ASSERT_EQ(store.text(4, 6), "c");
+    ASSERT_EQ(store.text(4, 5), "");
+    ASSERT_EQ(store.size(), 3);
+    std::vector<uint64_t> starts;
+    for (const InstructionRecord& record : store.ordered()) {
+        starts.push_back(record.startAddr);
+    }
+    ASSERT_EQ(starts, std::vector<uint64_t>({0, 4, 8}));
+}
+
+TEST(disas, COVERAGE_BITMAP) {
+    CoverageBitmap bitmap(200);
+    ASSERT_TRUE(bitmap.testAndSetRange(60, 130));
+    ASSERT_FALSE(bitmap.testAndSetRange(129, 140));
+    ASSERT_TRUE(bitmap[60] && bitmap[129] && !bitmap[59] && !bitmap[130]);
+    ASSERT_EQ(bitmap.count(), 70);
+    ASSERT_EQ(bitmap.count(100, 200), 30);
+    ASSERT_EQ(bitmap.findNextSet(0, 200), 60);
+    ASSERT_EQ(bitmap.findNextUnset(60, 200), 130);
+    ASSERT_EQ(bitmap.findNextUnset(60, 100), 100);
+
+    bitmap.resetRange(64, 128);
+    ASSERT_EQ(bitmap.count(), 6);
+    ASSERT_EQ(bitmap.findNextUnset(60, 200), 64);
+}
+
+TEST(disas, SECTION_LOCAL_STATE) {
+    std::vector<unsigned char> obj = {
+        0x90, 0x90, 0x90, 0x90,  // outside the section
+        0x90,                    // nop
+        0xeb, 0xf9,              // jmp 0 (outside the section)
+        0xc3,                    // ret (outside the section)
+    };
+    RecursiveDescentDisAssembler disas(obj, addr2symbol);
+    disas.disas(4, 6);
+
+    ASSERT_EQ(disas.isSuccessfullyDisAssembled.size(), 3);
+    ASSERT_EQ(disas.coveredBytes(0, obj.size()), 3);
+    ASSERT_EQ(disas.instructions.size(), 2);
+    ASSERT_EQ(disas.instructions.text(4, 5), "nop ");
+    ASSERT_TRUE(disas.isDecoded(5) && !disas.isDecoded(3));
+}
+
+TEST(disas, STRING_ARENA) {
+    StringArena arena;
+    std::string_view a = arena.store("nop ");
+    std::string big(StringArena::CHUNK_SIZE + 1, 'x');
+    std::string_view b = arena.store(big);
+    std::string_view c = arena.store("ret ");
+
+    ASSERT_EQ(a, "nop ");
+    ASSERT_EQ(b, big);
+    ASSERT_EQ(c, "ret ");
+    ASSERT_EQ(arena.bytesUsed(), big.size() + 8);
+}
+
+TEST(disas, PARALLEL_LINEAR_SWEEP) {
+    std::vector<unsigned char> obj(1 << 14);
+    uint32_t seed = 12345;
+    for (unsigned char &byte : obj) {
+        seed = seed * 1103515245 + 12345;
+        byte = seed >> 16;
+    }
+
+    LinearSweepDisAssembler sequential(obj, addr2symbol);
+    sequential.disas(3, obj.size() - 1);
+    LinearSweepDisAssembler parallel(obj, addr2symbol);
+    parallel.numThreads = 4;
+    parallel.chunkSize = 97;
+    parallel.disas(3, obj.size() - 1);
+
+    const std::vector<InstructionRecord> &expected =
+        sequential.instructions.ordered();
+    const std::vector<InstructionRecord> &actual =
+        parallel.instructions.ordered();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(actual[i].startAddr, expected[i].startAddr);
+        ASSERT_EQ(actual[i].endAddr, expected[i].endAddr);
+        ASSERT_EQ(actual[i].text, expected[i].text);
+    }
+    ASSERT_EQ(parallel.errorReport.total, sequential.errorReport.total);
+    ASSERT_EQ(parallel.maxInstructionStrSize,
+              sequential.maxInstructionStrSize);
+}
+
+TEST(disas, PARALLEL_RECURSIVE_DESCENT) {
+    std::vector<unsigned char> obj = {
+        0x74, 0x03,                    // jz 5
+        0x90,                          // nop
+        0x90,                          // nop
+        0xc3,                          // ret
+        0xe8, 0x02, 0x00, 0x00, 0x00,  // call c
+        0xc3,                          // ret
+        0x90,                          // (unreachable)
+        0x31, 0xc0,                    // xor eax eax
+        0xc3,                          // ret
+    };
+    RecursiveDescentDisAssembler sequential(obj, addr2symbol);
+    sequential.disas(0);
+    RecursiveDescentDisAssembler parallel(obj, addr2symbol);
+    parallel.numThreads = 4;
+    parallel.disas(0);
+
+    const std::vector<InstructionRecord> &expected =
+        sequential.instructions.ordered();
+    const std::vector<InstructionRecord> &actual =
+        parallel.instructions.ordered();
+    ASSERT_EQ(actual.size(), 8);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(actual[i].startAddr, expected[i].startAddr);
+        ASSERT_EQ(actual[i].text, expected[i].text);
+    }
+    ASSERT_FALSE(parallel.isDecoded(11));
+}
+
+TEST(disas, PARALLEL_RECURSIVE_DESCENT_OVERLAP) {
+    std::vector<unsigned char> obj = {
+        0x74, 0x01,                    // jz 3
+        0xb8, 0x90, 0x90, 0x90, 0xc3,  // mov eax 0xc3909090 (from 2)
+        0xc3,                          // ret
+    };
+    // the target 3 of jz is explored first and decodes nop nop nop ret,
+    // which overlap the mov at the fallthrough 2
+    RecursiveDescentDisAssembler sequential(obj, addr2symbol);
+    sequential.disas(0);
+    ASSERT_EQ(sequential.instructions.text(3, 4), "nop ");
+    ASSERT_FALSE(sequential.isDecoded(2));
+
+    for (size_t numThreads : {2, 4, 8}) {
+        for (int run = 0; run < 20; run++) {
+            RecursiveDescentDisAssembler parallel(obj, addr2symbol);
+            parallel.numThreads = numThreads;
+            parallel.disas(0);
+
+            const std::vector<InstructionRecord> &expected =
+                sequential.instructions.ordered();
+            const std::vector<InstructionRecord> &actual =
+                parallel.instructions.ordered();
+            ASSERT_EQ(actual.size(), expected.size());
+            for (size_t i = 0; i < expected.size(); i++) {
+                ASSERT_EQ(actual[i].startAddr, expected[i].startAddr);
+                ASSERT_EQ(actual[i].endAddr, expected[i].endAddr);
+                ASSERT_EQ(actual[i].text, expected[i].text);
+            }
+        }
+    }
+}
+
+TEST(disas, HYBRID) {
+    std::vector<unsigned char> obj = {
+        0xc3,        // ret
+        0xcc, 0xcc,  // padding
+        0x31, 0xc0,  // xor eax eax (not reachable from 0)
+        0xc3,        // ret
+        0x00, 0x00,  // padding
+    };
+    HybridDisAssembler disas(obj, addr2symbol);
+    disas.disas(0);
+
+    ASSERT_EQ(disas.instructions.size(), 3);
+    ASSERT_EQ(disas.instructions.text(0, 1), "ret ");
+    ASSERT_EQ(disas.instructions.text(3, 5), "xor  eax eax");
+    ASSERT_EQ(disas.instructions.text(5, 6), "ret ");
+    ASSERT_TRUE(disas.errorReport.empty());
+}
+
+TEST(disas, HYBRID_NO_OVERLAP) {
+    std::vector<unsigned char> obj = {
+        0x74, 0x02,              // jz 4
+        0x48, 0x83, 0xc4, 0x0f,  // add rsp 0x0f (4 and 5 do not decode)
+        0xc3,                    // ret
+        0x06,                    // invalid
+        0x90,                    // nop
+        0x06, 0x06,              // invalid
+        0xc3,                    // ret
+    };
+    HybridDisAssembler disas(obj, addr2symbol);
+    disas.disas(0);
+
+    // the error bytes inside the add are dropped, and each run of the
+    // others is one record
+    const std::vector<InstructionRecord> &records =
+        disas.instructions.ordered();
+    for (size_t i = 1; i < records.size(); i++) {
+        ASSERT_LE(records[i - 1].endAddr, records[i].startAddr);
+    }
+    ASSERT_EQ(records.size(), 7);
+    ASSERT_EQ(disas.instructions.text(2, 6), "add  rsp 0x0f");
+    ASSERT_EQ(disas.instructions.text(7, 8), UNKNOWN_INSTRUCTION);
+    ASSERT_EQ(disas.instructions.text(9, 11), UNKNOWN_INSTRUCTION);
+}
+
+TEST(disas, RECURSIVE_DESCENT_ROOTS) {
+    std::vector<unsigned char> obj = {
+        0xc3,        // ret
+        0x31, 0xc0,  // xor eax eax (only reachable from a root)
+        0xc3,        // ret
+    };
+    for (size_t numThreads : {1, 4}) {
+        RecursiveDescentDisAssembler disas(obj, addr2symbol);
+        disas.numThreads = numThreads;
+        disas.roots = {1, 100};
+        disas.disas(0);
+
+        ASSERT_EQ(disas.instructions.size(), 3);
+        ASSERT_EQ(disas.instructions.text(1, 3), "xor  eax eax");
+    }
+}
+
+TEST(disas, SYMBOL_INDEX) {
+    SymbolIndex symbols;
+    symbols.add(0x20, "second");
+    symbols.add(0x10, "first");
+    symbols.add(0x20, "alias");
+    symbols.sort();
+
+    ASSERT_EQ(symbols.size(), 2);
+    ASSERT_EQ(symbols.find(0x20).name, "second");
+    ASSERT_FALSE(symbols.find(0x1c));
+    ASSERT_FALSE(symbols.findPreceding(0x8));
+    ASSERT_EQ(symbols.findPreceding(0x1c).name, "first");
+    ASSERT_EQ(symbols.findPreceding(0x1c).offset, 0xc);
+    ASSERT_EQ(symbols.range(0x11, 0x21).first, 1);
+    ASSERT_EQ(symbols.range(0x11, 0x21).second, 2);
+
+    std::vector<unsigned char> obj = {
+        0x90,        // nop
+        0xeb, 0xfd,  // jmp 0
+        0xeb, 0xfc,  // jmp 1
+    };
+    SymbolIndex labels;
+    labels.add(0, "func");
+    labels.sort();
+    LinearSweepDisAssembler disas(obj, labels);
+    disas.disas(0);
+
+    ASSERT_EQ(disas.instructions.text(1, 3),
+              "jmp 0 <func> ; relative offset = -3");
+    ASSERT_EQ(disas.instructions.text(3, 5),
+              "jmp 1 <func+0x1> ; relative offset = -4");
+}
@@ -0,0 +1,191 @@
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "elfdisas.h"
+
+// the offset of the sections in the sparse file, past 4 GiB
+const uint64_t FAR_OFFSET = 0x120000000;
+
+// writes a relocatable object whose .text and section headers lie at
+// FAR_OFFSET, leaving a hole in front of them
+static std::string writeSparseObject(uint64_t textSize) {
+    std::string path = ::testing::TempDir() + "mydisas-sparse-XXXXXX";
+    int fd = ::mkstemp(&path[0]);
+    EXPECT_GE(fd, 0);
+
+    const unsigned char text[] = {
+        0x90,  // nop
+        0xC3   // ret
+    };
+    const char shstrtab[] = "\0.text\0.shstrtab";
+
+    ELF64_FILE_HEADER header = {};
+    std::memcpy(header.e_ident, "\x7f" "ELF\x02\x01\x01", 7);
+    header.e_type = ELF_ET_REL;
+    header.e_machine = 62;  // x86-64
+    header.e_version = 1;
+    header.e_shoff = FAR_OFFSET + 0x100;
+    header.e_ehsize = sizeof(ELF64_FILE_HEADER);
+    header.e_shentsize = sizeof(ELF64_SECTION_HEADER);
+    header.e_shnum = 3;
+    header.e_shstrndx = 2;
+
+    ELF64_SECTION_HEADER sections[3] = {};
+    sections[1].sh_name = 1;
+    sections[1].sh_type = 1;  // SHT_PROGBITS
+    sections[1].sh_offset = FAR_OFFSET;
+    sections[1].sh_size = textSize;
+    sections[2].sh_name = 7;
+    sections[2].sh_type = 3;  // SHT_STRTAB
+    sections[2].sh_offset = FAR_OFFSET + 0x40;
+    sections[2].sh_size = sizeof(shstrtab);
+
+    EXPECT_EQ(::pwrite(fd, &header, sizeof(header), 0),
+              (ssize_t)sizeof(header));
+    EXPECT_EQ(::pwrite(fd, text, sizeof(text), FAR_OFFSET),
+              (ssize_t)sizeof(text));
+    EXPECT_EQ(::pwrite(fd, shstrtab, sizeof(shstrtab), FAR_OFFSET + 0x40),
+              (ssize_t)sizeof(shstrtab));
+    EXPECT_EQ(::pwrite(fd, sections, sizeof(sections), header.e_shoff),
+              (ssize_t)sizeof(sections));
+    ::close(fd);
+    return path;
+}
+
+// the file offset and the virtual address of .text in the executable
+const uint64_t TEXT_OFFSET = 0x1000;
+const uint64_t TEXT_ADDR = 0x401000;
+
+// writes an executable whose roots are its entry point, a pointer of
+// .init_array and a function of .symtab
+static std::string writeExecutable() {
+    std::string path = ::testing::TempDir() + "mydisas-exec-XXXXXX";
+    int fd = ::mkstemp(&path[0]);
+    EXPECT_GE(fd, 0);
+
+    std::vector<unsigned char> text(0x40, 0xC3);  // ret
+    // the null pointers and pointers out of any section are not roots
+    const uint64_t initArray[] = {TEXT_ADDR + 0x20, 0, (uint64_t)-1,
+                                  0x900000};
+    const char strtab[] = "\0func\0object";
+    const char shstrtab[] =
+        "\0.text\0.init_array\0.symtab\0.strtab\0.shstrtab";
+
+    ELF64_SYM symbols[3] = {};
+    symbols[1].st_name = 1;
+    symbols[1].st_info = ELF_STT_FUNC;
+    symbols[1].st_shndx = 1;
+    symbols[1].st_value = TEXT_ADDR + 0x30;
+    symbols[2].st_name = 6;
+    symbols[2].st_info = 1;  // STT_OBJECT
+    symbols[2].st_shndx = 1;
+    symbols[2].st_value = TEXT_ADDR + 0x38;
+
+    ELF64_FILE_HEADER header = {};
+    std::memcpy(header.e_ident, "\x7f" "ELF\x02\x01\x01", 7);
+    header.e_type = 2;  // ET_EXEC
+    header.e_machine = 62;  // x86-64
+    header.e_version = 1;
+    header.e_entry = TEXT_ADDR + 0x10;
+    header.e_shoff = 0x2000;
+    header.e_ehsize = sizeof(ELF64_FILE_HEADER);
+    header.e_shentsize = sizeof(ELF64_SECTION_HEADER);
+    header.e_shnum = 6;
+    header.e_shstrndx = 5;
+
+    ELF64_SECTION_HEADER sections[6] = {};
+    sections[1].sh_name = 1;
+    sections[1].sh_type = 1;  // SHT_PROGBITS
+    sections[1].sh_addr = TEXT_ADDR;
+    sections[1].sh_offset = TEXT_OFFSET;
+    sections[1].sh_size = text.size();
+    sections[2].sh_name = 7;
+    sections[2].sh_type = 14;  // SHT_INIT_ARRAY
+    sections[2].sh_addr = 0x403000;
+    sections[2].sh_offset = 0x1100;
+    sections[2].sh_size = sizeof(initArray);
+    sections[3].sh_name = 19;
+    sections[3].sh_type = 2;  // SHT_SYMTAB
+    sections[3].sh_offset = 0x1200;
+    sections[3].sh_size = sizeof(symbols);
+    sections[4].sh_name = 27;
+    sections[4].sh_type = 3;  // SHT_STRTAB
+    sections[4].sh_offset = 0x1300;
+    sections[4].sh_size = sizeof(strtab);
+    sections[5].sh_name = 35;
+    sections[5].sh_type = 3;  // SHT_STRTAB
+    sections[5].sh_offset = 0x1400;
+    sections[5].sh_size = sizeof(shstrtab);
+
+    EXPECT_EQ(::pwrite(fd, &header, sizeof(header), 0),
+              (ssize_t)sizeof(header));
+    EXPECT_EQ(::pwrite(fd, text.data(), text.size(), TEXT_OFFSET),
+              (ssize_t)text.size());
+    EXPECT_EQ(::pwrite(fd, initArray, sizeof(initArray), 0x1100),
+              (ssize_t)sizeof(initArray));
+    EXPECT_EQ(::pwrite(fd, symbols, sizeof(symbols), 0x1200),
+              (ssize_t)sizeof(symbols));
+    EXPECT_EQ(::pwrite(fd, strtab, sizeof(strtab), 0x1300),
+              (ssize_t)sizeof(strtab));
+    EXPECT_EQ(::pwrite(fd, shstrtab, sizeof(shstrtab), 0x1400),
+              (ssize_t)sizeof(shstrtab));
+    EXPECT_EQ(::pwrite(fd, sections, sizeof(sections), header.e_shoff),
+              (ssize_t)sizeof(sections));
+    ::close(fd);
+    return path;
+}
+
+TEST(elf, SPARSE_FILE_LARGER_THAN_4GB) {
+    std::string path = writeSparseObject(2);
+    {
+        ELFDisAssembler eda(path, "ls");
+        ASSERT_EQ(eda.findSection(".text")->sh_offset, FAR_OFFSET);
+
+        eda.disas(".text");
+        ASSERT_EQ(eda.da->instructions.text(FAR_OFFSET, FAR_OFFSET + 1),
+                  "nop ");
+        ASSERT_EQ(eda.da->instructions.text(FAR_OFFSET + 1, FAR_OFFSET + 2),
+                  "ret ");
+    }
+    ::unlink(path.c_str());
+}
+
+TEST(elf, SECTION_OUTSIDE_OF_FILE) {
+    std::string path = writeSparseObject(0x100000000);
+    ASSERT_THROW(ELFDisAssembler(path, "ls"), std::runtime_error);
+    ::unlink(path.c_str());
+}
+
+TEST(elf, STRING_TABLE_VIEWS) {
+    const std::vector<unsigned char> strtab = {'a', 'b', '\0', 'c', 'd'};
+
+    ASSERT_EQ(getStringFromOffset(strtab, 0), "ab");
+    ASSERT_EQ(getStringFromOffset(strtab, 2), "");
+    // the view points into the table, and ends with it if unterminated
+    std::string_view cd = getStringFromOffset(strtab, 3);
+    ASSERT_EQ(cd, "cd");
+    ASSERT_EQ(static_cast<const void*>(cd.data()), strtab.data() + 3);
+    ASSERT_EQ(getStringFromOffset(strtab, 9), "");
+}
+
+TEST(elf, COLLECT_ROOTS) {
+    std::string path = writeExecutable();
+    {
+        ELFDisAssembler eda(path, "rd");
+        // the start of .text, the entry point, the pointer of .init_array
+        // and the function, but not the object
+        const std::vector<uint64_t> expected = {
+            TEXT_OFFSET, TEXT_OFFSET + 0x10, TEXT_OFFSET + 0x20,
+            TEXT_OFFSET + 0x30};
+        ASSERT_EQ(eda._collectRoots(), expected);
+    }
+    ::unlink(path.c_str());
+}
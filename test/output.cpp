@@ -0,0 +1,83 @@
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include "output.h"
+
+// writes through a sink into a temporary file and reads the file back
+template <typename F>
+static std::string writeThroughSink(F writeTo) {
+    std::string path = ::testing::TempDir() + "mydisas-output-XXXXXX";
+    int fd = ::mkstemp(&path[0]);
+    EXPECT_GE(fd, 0);
+    {
+        OutputSink out(fd);
+        writeTo(out);
+        EXPECT_EQ(out.error(), 0);
+    }
+    ::close(fd);
+
+    std::ifstream file(path, std::ios::binary);
+    std::string written((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    ::unlink(path.c_str());
+    return written;
+}
+
+TEST(output, HEX_TABLE) {
+    for (int byte = 0; byte < 256; byte++) {
+        char expected[3];
+        std::snprintf(expected, sizeof(expected), "%x", byte);
+        ASSERT_EQ(std::string(HEX_TABLE.digits[byte], HEX_TABLE.length[byte]),
+                  expected);
+    }
+}
+
+TEST(output, SINK_MATCHES_IOSTREAM) {
+    // about 0x40000 bytes, so that the buffer is written several times
+    // and lines cross its boundary
+    const int numLines = 0x4000;
+    std::ostringstream expected;
+    for (int i = 0; i < numLines; i++) {
+        expected << std::hex << i * 0x1001 << ": " << (i & 0xff)
+                 << std::string(i % 4, ' ') << "ret \n";
+    }
+    std::string written = writeThroughSink([&](OutputSink& out) {
+        for (int i = 0; i < numLines; i++) {
+            out.hex(i * 0x1001).write(": ").hexByte(i & 0xff);
+            out.fill(' ', i % 4).write("ret ").put('\n');
+        }
+    });
+    ASSERT_GT(written.size(), 4 * OutputSink::BUFFER_SIZE);
+    ASSERT_EQ(written, expected.str());
+}
+
+TEST(output, SINK_LARGER_THAN_BUFFER) {
+    // a string larger than the buffer is written past the buffered bytes
+    std::string large(OutputSink::BUFFER_SIZE + 100, 'x');
+    std::string written = writeThroughSink([&](OutputSink& out) {
+        out.write("head ").write(large).put('\n');
+    });
+    ASSERT_EQ(written, "head " + large + "\n");
+}
+
+TEST(output, SINK_WRITE_ERROR) {
+    int fd = ::open("/dev/full", O_WRONLY);
+    if (fd < 0) {
+        GTEST_SKIP() << "/dev/full is not available";
+    }
+    OutputSink out(fd);
+    out.write("lost").flush();
+    ASSERT_EQ(out.error(), ENOSPC);
+    // the output after the failure is dropped
+    out.write("dropped").flush();
+    ASSERT_EQ(out.error(), ENOSPC);
+    ::close(fd);
+}